@@ -34,6 +34,8 @@ copy ..\..\..\src\Common\IpTaggedObject.hpp                     ..\include\coin\
 copy ..\..\..\src\Common\IpTimedTask.hpp                        ..\include\coin\ /Y
 copy ..\..\..\src\Interfaces\IpTNLP.hpp                         ..\include\coin\ /Y
 copy ..\..\..\src\Interfaces\IpTNLPReducer.hpp                  ..\include\coin\ /Y
+copy ..\..\..\src\Interfaces\IpTNLPDecomposition.hpp         ..\include\coin\ /Y
+copy ..\..\..\src\Interfaces\IpWarmStartCache.hpp            ..\include\coin\ /Y
 copy ..\..\..\src\Common\IpTypes.hpp                            ..\include\coin\ /Y
 copy ..\..\..\src\Common\IpUtils.hpp                            ..\include\coin\ /Y
 
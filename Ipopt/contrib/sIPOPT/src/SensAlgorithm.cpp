@@ -32,7 +32,8 @@ namespace Ipopt
     SensitivityM_X_(NULL),
     SensitivityM_L_(NULL),
     SensitivityM_Z_L_(NULL),
-    SensitivityM_Z_U_(NULL)
+    SensitivityM_Z_U_(NULL),
+    batch_steps_(false)
   {
     DBG_START_METH("SensAlgorithm::SensAlgorithm", dbg_verbosity);
     DBG_ASSERT(n_sens_steps<=driver_vec.size());
@@ -54,6 +55,8 @@ namespace Ipopt
   bool SensAlgorithm::InitializeImpl(const OptionsList& options,
 				     const std::string& prefix)
   {
+    options.GetBoolValue("sens_batch_steps", batch_steps_, prefix);
+
     // initialize values for variable sizes, and allocate memory for sensitivity vectors
     nx_ = dynamic_cast<const DenseVector*>( GetRawPtr( IpData().curr()->x() ) )->Dim() ;
     nceq_ = dynamic_cast<const DenseVector*>( GetRawPtr( IpData().curr()->y_c() ) )->Dim() ;
@@ -106,6 +109,10 @@ namespace Ipopt
   {
     DBG_START_METH("SensAlgorithm::Run", dbg_verbosity);
 
+    if (batch_steps_) {
+      return RunBatch();
+    }
+
     SensAlgorithmExitStatus retval = SOLVE_SUCCESS;
 
     /* Loop through all steps */
@@ -140,6 +147,42 @@ namespace Ipopt
   }
 
 
+  SensAlgorithmExitStatus SensAlgorithm::RunBatch()
+  {
+    DBG_START_METH("SensAlgorithm::RunBatch", dbg_verbosity);
+
+    SensAlgorithmExitStatus retval = SOLVE_SUCCESS;
+
+    /* Collect the perturbations of all steps */
+    std::vector< SmartPtr<DenseVector> > delta_u(n_sens_steps_);
+    std::vector< SmartPtr<IteratesVector> > sol(n_sens_steps_);
+    for (Index step_i=0; step_i<n_sens_steps_; ++step_i) {
+      delta_u[step_i] = measurement_->GetMeasurement(step_i+1);
+      delta_u[step_i]->Print(Jnlst(),J_VECTOR,J_USER1,"delta_u");
+      sol[step_i] = IpData().curr()->MakeNewIteratesVector();
+    }
+
+    /* Compute all steps at once */
+    if (!sens_step_calc_->MultiStep(delta_u, sol, driver_vec_)) {
+      retval = FATAL_ERROR;
+    }
+
+    for (Index step_i=0; step_i<n_sens_steps_; ++step_i) {
+      sol[step_i]->Print(Jnlst(),J_VECTOR,J_USER1,"sol_vec");
+
+      // unscale solution...
+      UnScaleIteratesVector(&sol[step_i]) ;
+
+      // update variables
+      measurement_->SetSolution(step_i+1, sol[step_i]);
+    }
+
+    // get sensitivity vector of the last step, as in Run
+    GetDirectionalDerivatives() ;
+
+    return retval;
+  }
+
   SensAlgorithmExitStatus SensAlgorithm::ComputeSensitivityMatrix(void) {
     
     DBG_START_METH("SensAlgorithm::ComputeSensitivityMatrix", dbg_verbosity);
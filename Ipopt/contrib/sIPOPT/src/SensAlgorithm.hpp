@@ -75,6 +75,11 @@ namespace Ipopt
     SmartPtr<SensitivityStepCalculator> sens_step_calc_;
     SmartPtr<Measurement> measurement_;
     Index n_sens_steps_; // I think it is useful to state this number explicitly in the constructor and here.
+    /** Whether all steps are computed together with one backsolve */
+    bool batch_steps_;
+
+    /** Computes all steps together; called by Run if batch_steps_ */
+    SensAlgorithmExitStatus RunBatch();
 
     /** method to extract sensitivity vectors */
     void GetDirectionalDerivatives(void) ;
@@ -60,6 +60,16 @@ namespace Ipopt
 					   "n_sens_steps", "Number of steps computed by sIPOPT",
 					   0, 1,
 					   "");
+    roptions->AddStringOption2(
+			       "sens_batch_steps",
+			       "Compute all sIPOPT steps with one backsolve",
+			       "no",
+			       "no", "compute the steps one after another",
+			       "yes", "compute the steps together",
+			       "If this option is activated, the perturbations of all n_sens_steps steps are collected first, "
+			       "and the corresponding systems are solved together with one multiple right hand side backsolve "
+			       "with the factorized KKT matrix. Bound checks are done afterwards for each step. This is "
+			       "much faster if there are many steps.");
     roptions->AddStringOption2(
 			       "sens_boundcheck",
 			       "Activate boundcheck and re-solve for sIPOPT",
@@ -133,6 +143,15 @@ namespace Ipopt
 			       "yes", "compute eigenvalue decomposition of reduced hessian",
 			       "no", "don't compute eigenvalue decomposition of reduced hessian",
 			       "The eigenvalue decomposition of the reduced hessian has different meanings depending on the specific problem. For parameter estimation problems, the eigenvalues are linked to the confidence interval of the parameters. See for example Victor Zavala's Phd thesis, chapter 4 for details.");
+    roptions->AddStringOption2(
+			       "rh_diagonal_only",
+			       "If yes, only the diagonal of the reduced hessian matrix is computed",
+			       "no",
+			       "yes", "compute only the diagonal of the reduced hessian matrix",
+			       "no", "compute the whole reduced hessian matrix",
+			       "The diagonal (for example the variances of the parameters in a parameter estimation problem) "
+			       "is taken directly from the columns of the backsolves, and the dense matrix is not formed. "
+			       "This saves time and memory if many variables are selected. rh_eigendecomp is ignored in this case.");
     roptions->AddStringOption2(
 			       "sens_allow_inexact_backsolve",
 			       "Allow inexact computation of backsolve in sIPOPT.",
@@ -30,6 +30,19 @@ namespace Ipopt
 
     virtual bool Solve(SmartPtr<IteratesVector> delta_lhs, SmartPtr<const IteratesVector> delta_rhs)=0;
 
+    /** Solve for several right hand sides at once.  The default
+     *  implementation calls Solve for one right hand side after the
+     *  other. */
+    virtual bool MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhs,
+			    const std::vector<SmartPtr<const IteratesVector> >& delta_rhs)
+    {
+      bool retval = true;
+      for (Index i=0; i<(Index)delta_rhs.size() && retval; ++i) {
+	retval = Solve(delta_lhs[i], delta_rhs[i]);
+      }
+      return retval;
+    }
+
   };
 
 }
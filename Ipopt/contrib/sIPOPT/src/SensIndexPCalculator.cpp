@@ -52,45 +52,56 @@ namespace Ipopt
     DBG_START_METH("IndexPCalculator::ComputeP", dbg_verbosity);
     bool retval = true;
 
-    // 1. check whether all columns needed by data_A() are in map cols_ - we suppose data_A is IndexSchurData
+    // 1. collect the columns needed by data_A() that are not yet in P - we suppose data_A is IndexSchurData
     const std::vector<Index>* p2col_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(data_A()))->GetColIndices();
-    Index col;
-    Number* col_values = NULL;
-    Index curr_dim, curr_schur_row=0;
-    SmartPtr<const DenseVector> comp_vec;
-    const Number* comp_values;
-    std::map< Index, SmartPtr<PColumn> >::iterator find_it;
-    SmartPtr<IteratesVector> col_vec = IpData().curr()->MakeNewIteratesVector();
-    SmartPtr<IteratesVector> sol_vec = col_vec->MakeNewIteratesVector();
+    const Index ncomputed = (nrows_>0) ? (Index)P_values_.size()/nrows_ : 0;
+    std::vector<Index> new_cols;
+    std::vector<SmartPtr<const IteratesVector> > rhs_vecs;
+    std::vector<SmartPtr<IteratesVector> > sol_vecs;
+    Index curr_schur_row = 0;
     for (std::vector<Index>::const_iterator col_it=p2col_idx->begin(); col_it!=p2col_idx->end(); ++col_it){
-      col = *col_it;
-
-      find_it = cols_.find(col);
-      if (find_it==cols_.end()) {
+      if (col_pos_.find(*col_it)==col_pos_.end()) {
 	// column is in data_A but not in P-matrix ->create
+	SmartPtr<IteratesVector> col_vec = IpData().curr()->MakeNewIteratesVector();
 	data_A()->GetRow(curr_schur_row, *col_vec);
-	retval = Solver()->Solve(sol_vec, ConstPtr(col_vec));
-	DBG_ASSERT(retval);
-
-	/* This part is for displaying norm2(I_z*K^(-1)*I_1) */
-	DBG_PRINT((dbg_verbosity,"\ncurr_schur_row=%d, ",curr_schur_row));
-	DBG_PRINT((dbg_verbosity,"norm2(z)=%23.16e\n",sol_vec->x()->Nrm2()));
-	/* end displaying norm2 */
-
-	DBG_ASSERT(col_values== NULL);
-	col_values = new Number[nrows_];
-	curr_dim = 0;
-	for (Index j=0; j<sol_vec->NComps(); ++j) {
-	  comp_vec = dynamic_cast<const DenseVector*>(GetRawPtr(sol_vec->GetComp(j)));
-	  comp_values = comp_vec->Values();
-	  IpBlasDcopy(comp_vec->Dim(), comp_values, 1, col_values+curr_dim,1);
-	  curr_dim += comp_vec->Dim();
-	}
-	cols_[col] = new PColumn(nrows_, col_values);
-	col_values = NULL;
+	rhs_vecs.push_back(ConstPtr(col_vec));
+	sol_vecs.push_back(col_vec->MakeNewIteratesVector());
+	col_pos_[*col_it] = ncomputed + (Index)new_cols.size();
+	new_cols.push_back(*col_it);
       }
       curr_schur_row++;
     }
+    if (new_cols.empty()) {
+      return retval;
+    }
+
+    // 2. solve for all new columns at once
+    retval = Solver()->MultiSolve(sol_vecs, rhs_vecs);
+    DBG_ASSERT(retval);
+    if (!retval) {
+      for (Index k=0; k<(Index)new_cols.size(); ++k) {
+	col_pos_.erase(new_cols[k]);
+      }
+      return retval;
+    }
+
+    // 3. append the solutions as columns to P
+    P_values_.resize((ncomputed + new_cols.size())*nrows_);
+    SmartPtr<const DenseVector> comp_vec;
+    for (Index k=0; k<(Index)new_cols.size(); ++k) {
+      /* This part is for displaying norm2(I_z*K^(-1)*I_1) */
+      DBG_PRINT((dbg_verbosity,"\nnew column %d, ",new_cols[k]));
+      DBG_PRINT((dbg_verbosity,"norm2(z)=%23.16e\n",sol_vecs[k]->x()->Nrm2()));
+      /* end displaying norm2 */
+
+      Number* col_values = &P_values_[(ncomputed + k)*nrows_];
+      Index curr_dim = 0;
+      for (Index j=0; j<sol_vecs[k]->NComps(); ++j) {
+	comp_vec = dynamic_cast<const DenseVector*>(GetRawPtr(sol_vecs[k]->GetComp(j)));
+	IpBlasDcopy(comp_vec->Dim(), comp_vec->Values(), 1, col_values+curr_dim,1);
+	curr_dim += comp_vec->Dim();
+      }
+    }
 
     return retval;
   }
@@ -145,14 +156,58 @@ namespace Ipopt
     // Compute S = B^T*P from indices, factors and P
     const std::vector<Index>* data_A_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(data_A()))->GetColIndices();
     const std::vector<Index>* data_B_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(B))->GetColIndices();
+    const Index nrows_S = (Index)data_B_idx->size();
+
+    // P holds the columns in the order of data_A, unless data_A has
+    // been changed after they were computed.  Then, B^T*P consists of
+    // the rows of the dense block selected by B, which are copied
+    // into the rows of S.
+    bool P_in_A_order = true;
+    for (Index k=0; k<(Index)data_A_idx->size() && P_in_A_order; ++k) {
+      P_in_A_order = (col_pos_[(*data_A_idx)[k]]==k);
+    }
+    if (P_in_A_order) {
+      for (Index i=0; i<nrows_S; ++i) {
+	IpBlasDcopy((Index)data_A_idx->size(), &P_values_[(*data_B_idx)[i]], nrows_, S_values+i, ncols_);
+	IpBlasDscal((Index)data_A_idx->size(), -1., S_values+i, ncols_);
+      }
+      return retval;
+    }
+
     Index col_count = 0;
     for (std::vector<Index>::const_iterator a_it=data_A_idx->begin(); a_it!=data_A_idx->end(); ++a_it) {
-      cols_[*a_it]->GetSchurMatrixRows(data_B_idx, S_values+col_count*ncols_);
+      const Number* P_col = &P_values_[col_pos_[*a_it]*nrows_];
+      Number* S_col = S_values+col_count*ncols_;
+      for (Index i=0; i<nrows_S; ++i) {
+	S_col[i] = -P_col[(*data_B_idx)[i]];
+      }
       col_count++;
     }
     return retval;
   }
 
+  bool IndexPCalculator::GetSchurMatrixDiagonal(const SmartPtr<const SchurData>& B, std::vector<Number>& diag)
+  {
+    DBG_START_METH("IndexPCalculator::GetSchurMatrixDiagonal", dbg_verbosity);
+    bool retval = true;
+
+    // Check whether data_A was changed from the outside
+    if (ncols_!=data_A()->GetNRowsAdded()) {
+      ncols_ = data_A()->GetNRowsAdded();
+      retval = ComputeP();
+    }
+
+    // Only the entries S_ii = B_i^T*P_i are needed
+    const std::vector<Index>* data_A_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(data_A()))->GetColIndices();
+    const std::vector<Index>* data_B_idx = dynamic_cast<const IndexSchurData*>(GetRawPtr(B))->GetColIndices();
+    DBG_ASSERT(data_A_idx->size()==data_B_idx->size());
+    diag.resize(data_A_idx->size());
+    for (Index i=0; i<(Index)data_A_idx->size(); ++i) {
+      diag[i] = -P_values_[col_pos_[(*data_A_idx)[i]]*nrows_ + (*data_B_idx)[i]];
+    }
+    return retval;
+  }
+
   void IndexPCalculator::PrintImpl(const Journalist& jnlst,
 				   EJournalLevel level,
 				   EJournalCategory category,
@@ -162,48 +217,17 @@ namespace Ipopt
   {
     DBG_START_METH("IndexPCalculator::PrintImpl", dbg_verbosity);
 
-    const Number* col_val;
     jnlst.PrintfIndented(level, category, indent,
                          "%sIndexPCalculator \"%s\" with %d rows and %d columns:\n",
                          prefix.c_str(), name.c_str(), nrows_, ncols_ );
-    Index col_counter = 0;
-    for (std::map< Index, SmartPtr<PColumn> >::const_iterator j=cols_.begin(); j!=cols_.end(); ++j) {
-      col_val = j->second->Values();
+    const Index ncomputed = (nrows_>0) ? (Index)P_values_.size()/nrows_ : 0;
+    for (Index j=0; j<ncomputed; ++j) {
+      const Number* col_val = &P_values_[j*nrows_];
       for (Index i=0; i<nrows_; ++i) {
 	jnlst.PrintfIndented(level, category, indent,
 			     "%s%s[%5d,%5d]=%23.16e\n",
-			     prefix.c_str(), name.c_str(), i, col_counter, col_val[i]);
+			     prefix.c_str(), name.c_str(), i, j, col_val[i]);
       }
-      col_counter++;
-    }
-  }
-
-  PColumn::PColumn(Index nrows, Number* values)
-    :
-    nrows_(nrows),
-    val_(values)
-  {
-    DBG_START_METH("PColumn::PColumn", dbg_verbosity);
-  }
-
-  PColumn::~PColumn()
-  {
-    DBG_START_METH("PColumn::~PColumn", dbg_verbosity);
-    delete[] val_;
-  }
-
-  void PColumn::GetSchurMatrixRows(const std::vector<Index>* row_idx_B, Number* S_col) const
-  {
-    DBG_START_METH("PColumn::GetSchurMatrixRows", dbg_verbosity);
-
-    for (Index i=0; i<row_idx_B->size(); ++i) {
-      S_col[i] = -val_[(*row_idx_B)[i]];
     }
   }
-
-  const Number* PColumn::Values() const
-  {
-    DBG_START_METH("PColumn::Values", dbg_verbosity);
-    return val_;
-  }
 }
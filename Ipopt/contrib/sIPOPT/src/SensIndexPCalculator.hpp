@@ -9,10 +9,11 @@
 
 #include "SensPCalculator.hpp"
 
+#include <map>
+#include <vector>
+
 namespace Ipopt
 {
-  /* Forward declarations */
-  class PColumn;
 
   class IndexPCalculator : public PCalculator
   {
@@ -34,6 +35,8 @@ namespace Ipopt
 
     virtual bool GetSchurMatrix(const SmartPtr<const SchurData>& B, SmartPtr<Matrix>& S);
 
+    virtual bool GetSchurMatrixDiagonal(const SmartPtr<const SchurData>& B, std::vector<Number>& diag);
+
     virtual void PrintImpl(const Journalist& jnlst,
 			   EJournalLevel level,
 			   EJournalCategory category,
@@ -49,28 +52,15 @@ namespace Ipopt
     /** Cols of P */
     Index ncols_;
 
-    std::map< Index, SmartPtr<PColumn> > cols_;
-
-  };
+    /** Columns of P computed so far, stored as a dense column-major
+     *  matrix with nrows_ rows.  The columns are computed together
+     *  with one call of the backsolver's MultiSolve. */
+    std::vector<Number> P_values_;
 
-  class PColumn : public ReferencedObject
-  {
-    /** This class provides an easy interface for PCalculators with data where columns are
-     *  not necessarily in adjacent parts of memory. */
-
-  public:
-    PColumn(Index nrows, Number* values);
+    /** Position of the column in P_values_ for each index of the
+     *  KKT system for which a column has been computed */
+    std::map< Index, Index > col_pos_;
 
-    virtual ~PColumn();
-
-    virtual void GetSchurMatrixRows(const std::vector<Index>* row_idx_B, Number* S) const;
-
-    virtual const Number* Values() const;
-
-  private:
-
-    Index nrows_;
-    Number* val_;
   };
 
 }
@@ -54,6 +54,11 @@ namespace Ipopt
     /** Function to extract a SchurMatrix corresponding to $B K^{-1} A$. If B==NULL, use A=B*/
     virtual bool GetSchurMatrix(const SmartPtr<const SchurData>& B, SmartPtr<Matrix>& S) =0;
 
+    /** Function to extract only the diagonal of the SchurMatrix
+     *  corresponding to $B K^{-1} A$, without forming the whole
+     *  matrix.  B must have as many rows as A. */
+    virtual bool GetSchurMatrixDiagonal(const SmartPtr<const SchurData>& B, std::vector<Number>& diag) =0;
+
     virtual void PrintImpl(const Journalist& jnlst,
 			   EJournalLevel level,
 			   EJournalCategory category,
@@ -6,6 +6,9 @@
 
 #include "SensReducedHessianCalculator.hpp"
 #include "IpDenseGenMatrix.hpp"
+#include "IpDenseVector.hpp"
+
+#include <vector>
 
 namespace Ipopt
 {
@@ -32,6 +35,13 @@ namespace Ipopt
   {
     DBG_START_METH("ReducedHessianCalculator::InitializeImpl", dbg_verbosity);
     options.GetBoolValue("rh_eigendecomp", compute_eigenvalues_, prefix);
+    options.GetBoolValue("rh_diagonal_only", diagonal_only_, prefix);
+    if (diagonal_only_ && compute_eigenvalues_) {
+      Jnlst().Printf(J_WARNING, J_MAIN,
+		     "The eigenvalue decomposition of the reduced hessian requires the whole matrix,\n"
+		     "so rh_eigendecomp is ignored since rh_diagonal_only is set.\n");
+      compute_eigenvalues_ = false;
+    }
     return true;
   }
 
@@ -39,6 +49,10 @@ namespace Ipopt
   {
     DBG_START_METH("ReducedHessianCalculator::ComputeReducedHessian", dbg_verbosity);
 
+    if (diagonal_only_) {
+      return ComputeReducedHessianDiagonal();
+    }
+
     Index dim_S = hess_data_->GetNRowsAdded();
     //SmartPtr<DenseGenMatrixSpace> S_space = new DenseGenMatrixSpace(dim_S, dim_S);
     //SmartPtr<DenseGenMatrix> S = new DenseGenMatrix(GetRawPtr(S_space));
@@ -51,6 +65,58 @@ namespace Ipopt
       throw (exc);
     }
 
+    PrintScalingWarning();
+
+    // Unscale by objective factor and multiply by (-1)
+    Number obj_scal = IpNLP().NLP_scaling()->apply_obj_scaling(1.0);
+    DBG_PRINT((dbg_verbosity, "Objective scaling = %f\n", obj_scal));
+    Number* s_val = S_sym->Values();
+    for (Index k=0; k<(S->NRows())*(S->NCols()); ++k) {
+      s_val[k] *= -obj_scal;
+    }
+
+    S->Print(Jnlst(),J_INSUPPRESSIBLE,J_USER1,"RedHessian unscaled");
+
+    if ( compute_eigenvalues_ ) {
+      SmartPtr<DenseGenMatrixSpace> eigenvectorspace = new DenseGenMatrixSpace(dim_S, dim_S);
+      SmartPtr<DenseGenMatrix> eigenvectors = new DenseGenMatrix(GetRawPtr(eigenvectorspace));
+      SmartPtr<DenseVectorSpace> eigenvaluesspace = new DenseVectorSpace(dim_S);
+      SmartPtr<DenseVector> eigenvalues = new DenseVector(GetRawPtr(eigenvaluesspace));
+
+      eigenvectors->ComputeEigenVectors(*S_sym, *eigenvalues);
+      eigenvalues->Print(Jnlst(),J_INSUPPRESSIBLE,J_USER1,"Eigenvalues of reduced hessian matrix");
+    }
+
+    return retval;
+  }
+
+  bool ReducedHessianCalculator::ComputeReducedHessianDiagonal()
+  {
+    DBG_START_METH("ReducedHessianCalculator::ComputeReducedHessianDiagonal", dbg_verbosity);
+
+    Index dim_S = hess_data_->GetNRowsAdded();
+    std::vector<Number> diag;
+    bool retval = pcalc_->GetSchurMatrixDiagonal(GetRawPtr(hess_data_), diag);
+
+    PrintScalingWarning();
+
+    // Unscale by objective factor and multiply by (-1)
+    Number obj_scal = IpNLP().NLP_scaling()->apply_obj_scaling(1.0);
+    DBG_PRINT((dbg_verbosity, "Objective scaling = %f\n", obj_scal));
+    SmartPtr<DenseVectorSpace> diag_space = new DenseVectorSpace(dim_S);
+    SmartPtr<DenseVector> diag_vec = new DenseVector(GetRawPtr(diag_space));
+    Number* d_val = diag_vec->Values();
+    for (Index k=0; k<dim_S; ++k) {
+      d_val[k] = -obj_scal*diag[k];
+    }
+
+    diag_vec->Print(Jnlst(),J_INSUPPRESSIBLE,J_USER1,"RedHessian unscaled diagonal");
+
+    return retval;
+  }
+
+  void ReducedHessianCalculator::PrintScalingWarning()
+  {
     bool have_x_scaling, have_c_scaling, have_d_scaling;
     have_x_scaling = IpNLP().NLP_scaling()->have_x_scaling();
     have_c_scaling = IpNLP().NLP_scaling()->have_c_scaling();
@@ -79,29 +145,6 @@ namespace Ipopt
 		     "-------------------------------------------------------------------------------\n\n");
 
     }
-
-    // Unscale by objective factor and multiply by (-1)
-    Number obj_scal = IpNLP().NLP_scaling()->apply_obj_scaling(1.0);
-    DBG_PRINT((dbg_verbosity, "Objective scaling = %f\n", obj_scal));
-    Number* s_val = S_sym->Values();
-    for (Index k=0; k<(S->NRows())*(S->NCols()); ++k) {
-      s_val[k] *= -obj_scal;
-    }
-
-    S->Print(Jnlst(),J_INSUPPRESSIBLE,J_USER1,"RedHessian unscaled");
-
-    if ( compute_eigenvalues_ ) {
-      SmartPtr<DenseGenMatrixSpace> eigenvectorspace = new DenseGenMatrixSpace(dim_S, dim_S);
-      SmartPtr<DenseGenMatrix> eigenvectors = new DenseGenMatrix(GetRawPtr(eigenvectorspace));
-      SmartPtr<DenseVectorSpace> eigenvaluesspace = new DenseVectorSpace(dim_S);
-      SmartPtr<DenseVector> eigenvalues = new DenseVector(GetRawPtr(eigenvaluesspace));
-
-      eigenvectors->ComputeEigenVectors(*S_sym, *eigenvalues);
-      eigenvalues->Print(Jnlst(),J_INSUPPRESSIBLE,J_USER1,"Eigenvalues of reduced hessian matrix");
-    }
-
-    return retval;
   }
 
-
 }
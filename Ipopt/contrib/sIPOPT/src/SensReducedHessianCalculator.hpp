@@ -32,6 +32,13 @@ namespace Ipopt
 
   private:
 
+    /** Computes only the diagonal of the unscaled reduced hessian
+     *  matrix; called by ComputeReducedHessian if diagonal_only_ */
+    bool ComputeReducedHessianDiagonal();
+
+    /** Prints a warning if the NLP is scaled */
+    void PrintScalingWarning();
+
     /** Pointer to Schurdata object holding the indices for selecting the free variables */
     SmartPtr<SchurData> hess_data_;
 
@@ -40,6 +47,9 @@ namespace Ipopt
 
     /** True, if option rh_eigendecomp was set to yes */
     bool compute_eigenvalues_;
+
+    /** True, if option rh_diagonal_only was set to yes */
+    bool diagonal_only_;
   };
 
 }
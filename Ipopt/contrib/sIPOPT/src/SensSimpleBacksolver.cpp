@@ -44,4 +44,12 @@ namespace Ipopt
 
     return retval;
   }
+
+  bool SimpleBacksolver::MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhs,
+				    const std::vector<SmartPtr<const IteratesVector> >& delta_rhs)
+  {
+    DBG_START_METH("SimpleBacksolver::MultiSolve", dbg_verbosity);
+
+    return pd_solver_->MultiSolve(delta_rhs, delta_lhs, allow_inexact_);
+  }
 } // end namespace
@@ -29,6 +29,11 @@ namespace Ipopt {
 
     bool Solve(SmartPtr<IteratesVector> delta_lhs, SmartPtr<const IteratesVector> delta_rhs);
 
+    /** Solve for all right hand sides with one call of the
+     *  PDSystemSolver, which can do the backsolves together. */
+    bool MultiSolve(std::vector<SmartPtr<IteratesVector> >& delta_lhs,
+		    const std::vector<SmartPtr<const IteratesVector> >& delta_rhs);
+
 
   private:
 
@@ -34,6 +34,13 @@ namespace Ipopt
      *  a step using its SchurDriver, checks bounds, and returns it */
     virtual bool Step(DenseVector& delta_u, IteratesVector& sol);
 
+    /** Computes the steps for several perturbations with one
+     *  backsolve.  Bound violations are corrected separately for
+     *  each perturbation, using drivers[i] for the i-th one. */
+    virtual bool MultiStep(std::vector< SmartPtr<DenseVector> >& delta_u,
+			   std::vector< SmartPtr<IteratesVector> >& sol,
+			   std::vector< SmartPtr<SchurDriver> >& drivers);
+
     bool BoundCheck(IteratesVector& sol,
 		    std::vector<Index>& x_bound_violations_idx,
 		    std::vector<Number>& x_bound_violations_du);
@@ -42,6 +49,21 @@ namespace Ipopt
     virtual SmartPtr<IteratesVector> GetSensitivityVector(void) { return SensitivityVector ; } ;
 
   private:
+    /** Returns the KKT residuals at the current point */
+    SmartPtr<IteratesVector> KKTResiduals();
+
+    /** Returns the right hand side of the step for delta_u; r_s are
+     *  the KKT residuals, or NULL if they should not be included */
+    SmartPtr<IteratesVector> StepRhs(DenseVector& delta_u,
+				     const IteratesVector* r_s);
+
+    /** Corrects the step sol (including the current point) with the
+     *  Schur complement of the Driver() until no bounds are
+     *  violated.  Kr_s is the uncorrected step. */
+    bool BoundCorrection(SmartPtr<IteratesVector> delta_u_long,
+			 SmartPtr<IteratesVector> Kr_s,
+			 IteratesVector& sol);
+
     SmartPtr<SchurData> ift_data_;
     SmartPtr<SensBacksolver> backsolver_;
     Number bound_eps_;
@@ -10,6 +10,8 @@
 #include "IpAlgStrategy.hpp"
 #include "SensSchurDriver.hpp"
 
+#include <vector>
+
 
 namespace Ipopt
 {
@@ -65,6 +67,13 @@ namespace Ipopt
      *  a step using its SchurDriver, checks bounds, and returns it */
     virtual bool Step(DenseVector& delta_u, IteratesVector& sol) =0;
 
+    /** Calculates the steps for several perturbations delta_u at
+     *  once, against the same factorization.  For the bound check of
+     *  the i-th step, drivers[i] is used as SchurDriver. */
+    virtual bool MultiStep(std::vector< SmartPtr<DenseVector> >& delta_u,
+			   std::vector< SmartPtr<IteratesVector> >& sol,
+			   std::vector< SmartPtr<SchurDriver> >& drivers) =0;
+
     /** return the sensitivity vector */
     virtual SmartPtr<IteratesVector> GetSensitivityVector() = 0;
 
@@ -0,0 +1,528 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpIpoptApplication.hpp"
+#include "IpSolveStatistics.hpp"
+#include "IpIpoptData.hpp"
+#include "IpTimingStatistics.hpp"
+#include "IpUtils.hpp"
+#include "RegisteredTNLP.hpp"
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#else
+#include "configall_system.h"
+#endif
+
+#ifdef HAVE_CSTDIO
+# include <cstdio>
+#else
+# ifdef HAVE_STDIO_H
+#  include <stdio.h>
+# else
+#  error "don't have header file for stdio"
+# endif
+#endif
+
+#ifdef HAVE_CSTDLIB
+# include <cstdlib>
+#else
+# ifdef HAVE_STDLIB_H
+#  include <stdlib.h>
+# else
+#  error "don't have header file for stdlib"
+# endif
+#endif
+
+#ifdef HAVE_CSTRING
+# include <cstring>
+#else
+# ifdef HAVE_STRING_H
+#  include <string.h>
+# else
+#  error "don't have header file for string"
+# endif
+#endif
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace Ipopt;
+using namespace std;
+
+// The list of all problems
+#include "RegisteredProblems.hpp"
+
+/** Setting and results of a single benchmark run */
+struct BenchmarkRun
+{
+  /** Name of the registered problem */
+  string problem;
+  /** Size parameter of the problem */
+  Index N;
+  /** Ipopt options as pairs of name and value */
+  vector<pair<string, string> > options;
+
+  /** Return status of the last solve */
+  int status;
+  /** Number of iterations of the last solve */
+  Index iterations;
+  /** Final objective value of the last solve */
+  Number objective;
+  /** Minimal wall clock time over all repetitions */
+  Number wall_time;
+  /** CPU time of the run with the minimal wall clock time */
+  Number cpu_time;
+  /** Wall clock times of the timed tasks for the run with the
+   *  minimal wall clock time */
+  vector<Number> task_times;
+
+  /** Options as one string (used to identify the run) */
+  string OptionsString() const
+  {
+    string str;
+    for (Index i=0; i<(Index)options.size(); i++) {
+      if (i>0) {
+        str += " ";
+      }
+      str += options[i].first + "=" + options[i].second;
+    }
+    return str;
+  }
+
+  /** Key identifying the setting of the run */
+  string Key() const
+  {
+    char buf[32];
+    sprintf(buf, "%d", N);
+    return problem + "," + buf + "," + OptionsString();
+  }
+};
+
+/** Results of a run in the baseline */
+struct BaselineRun
+{
+  int status;
+  Index iterations;
+  Number wall_time;
+};
+
+/** Split a string at the given separator */
+static vector<string> split(const string& str, char sep)
+{
+  vector<string> parts;
+  string::size_type start = 0;
+  while (true) {
+    string::size_type pos = str.find(sep, start);
+    if (pos == string::npos) {
+      parts.push_back(str.substr(start));
+      break;
+    }
+    parts.push_back(str.substr(start, pos-start));
+    start = pos + 1;
+  }
+  return parts;
+}
+
+/** Read the benchmark specification.  Every line (except empty lines
+ *  and lines starting with '#') is of the form
+ *
+ *    PROBLEM SIZES [OPTION=VALUES ...]
+ *
+ *  where PROBLEM, SIZES and VALUES can be comma separated lists.  A
+ *  run is created for every combination of the list entries. */
+static bool read_spec(const char* filename, vector<BenchmarkRun>& runs)
+{
+  ifstream is(filename);
+  if (!is) {
+    printf("Cannot open benchmark specification file \"%s\".\n", filename);
+    return false;
+  }
+
+  string line;
+  Index lineno = 0;
+  while (getline(is, line)) {
+    lineno++;
+    istringstream ls(line);
+    vector<string> tokens;
+    string token;
+    while (ls >> token) {
+      tokens.push_back(token);
+    }
+    if (tokens.size() == 0 || tokens[0][0] == '#') {
+      continue;
+    }
+    if (tokens.size() < 2) {
+      printf("Line %d of \"%s\": problem name and size expected.\n",
+             lineno, filename);
+      return false;
+    }
+
+    // start with all combinations of problems and sizes
+    vector<BenchmarkRun> line_runs;
+    vector<string> problems = split(tokens[0], ',');
+    vector<string> sizes = split(tokens[1], ',');
+    for (Index i=0; i<(Index)problems.size(); i++) {
+      if (IsNull(RegisteredTNLPs::GetTNLP(problems[i]))) {
+        printf("Line %d of \"%s\": problem with name \"%s\" not known.\n",
+               lineno, filename, problems[i].c_str());
+        return false;
+      }
+      for (Index j=0; j<(Index)sizes.size(); j++) {
+        BenchmarkRun run;
+        run.problem = problems[i];
+        run.N = atoi(sizes[j].c_str());
+        if (run.N <= 0) {
+          printf("Line %d of \"%s\": invalid problem size \"%s\".\n",
+                 lineno, filename, sizes[j].c_str());
+          return false;
+        }
+        line_runs.push_back(run);
+      }
+    }
+
+    // and combine them with all values of the options
+    for (Index k=2; k<(Index)tokens.size(); k++) {
+      string::size_type pos = tokens[k].find('=');
+      if (pos == string::npos || pos == 0) {
+        printf("Line %d of \"%s\": option=value expected instead of \"%s\".\n",
+               lineno, filename, tokens[k].c_str());
+        return false;
+      }
+      string name = tokens[k].substr(0, pos);
+      vector<string> values = split(tokens[k].substr(pos+1), ',');
+      vector<BenchmarkRun> new_runs;
+      for (Index i=0; i<(Index)line_runs.size(); i++) {
+        for (Index j=0; j<(Index)values.size(); j++) {
+          new_runs.push_back(line_runs[i]);
+          new_runs.back().options.push_back(make_pair(name, values[j]));
+        }
+      }
+      line_runs = new_runs;
+    }
+
+    runs.insert(runs.end(), line_runs.begin(), line_runs.end());
+  }
+  return true;
+}
+
+/** Solve the problem of a run repeat times, and keep the results of
+ *  the fastest solve */
+static void do_run(BenchmarkRun& run, Index repeat)
+{
+  run.status = Internal_Error;
+  run.iterations = -1;
+  run.objective = 0.;
+  run.wall_time = -1.;
+  run.cpu_time = 0.;
+
+  for (Index rep=0; rep<repeat; rep++) {
+    SmartPtr<RegisteredTNLP> tnlp = RegisteredTNLPs::GetTNLP(run.problem);
+    if (!tnlp->InitializeProblem(run.N)) {
+      printf("Cannot initialize problem %s with N = %d.\n",
+             run.problem.c_str(), run.N);
+      return;
+    }
+
+    // The options are passed as a stream, so that an options file in
+    // the current directory does not change the benchmark.
+    ostringstream opts;
+    opts << "print_level 0\n" << "sb yes\n";
+    for (Index i=0; i<(Index)run.options.size(); i++) {
+      opts << run.options[i].first << " " << run.options[i].second << "\n";
+    }
+    istringstream is(opts.str());
+
+    SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+    ApplicationReturnStatus status = app->Initialize(is, true);
+    if (status != Solve_Succeeded) {
+      run.status = status;
+      return;
+    }
+
+    Number start_time = WallclockTime();
+    status = app->OptimizeTNLP(GetRawPtr(tnlp));
+    Number wall_time = WallclockTime() - start_time;
+
+    if (run.wall_time >= 0. && wall_time >= run.wall_time) {
+      continue;
+    }
+    run.status = status;
+    run.wall_time = wall_time;
+    SmartPtr<SolveStatistics> stats = app->Statistics();
+    if (IsValid(stats)) {
+      run.iterations = stats->IterationCount();
+      run.objective = stats->FinalObjective();
+      run.cpu_time = stats->TotalCpuTime();
+    }
+    const TimingStatistics& timing = app->IpoptDataObject()->TimingStats();
+    run.task_times.resize(timing.NumberOfTasks());
+    for (Index i=0; i<timing.NumberOfTasks(); i++) {
+      run.task_times[i] = timing.Task(i).TotalWallclockTime();
+    }
+  }
+}
+
+/** Write the results in CSV format */
+static bool write_csv(const char* filename,
+                      const vector<BenchmarkRun>& runs,
+                      const vector<string>& task_names)
+{
+  FILE* fp = fopen(filename, "w");
+  if (!fp) {
+    printf("Cannot open file \"%s\" for writing.\n", filename);
+    return false;
+  }
+  fprintf(fp, "problem,N,options,status,iterations,objective,wall_time,cpu_time");
+  for (Index i=0; i<(Index)task_names.size(); i++) {
+    fprintf(fp, ",%s", task_names[i].c_str());
+  }
+  fprintf(fp, "\n");
+  for (Index k=0; k<(Index)runs.size(); k++) {
+    const BenchmarkRun& run = runs[k];
+    fprintf(fp, "%s,%d,%s,%d,%d,%.16e,%.6f,%.6f",
+            run.problem.c_str(), run.N, run.OptionsString().c_str(),
+            run.status, run.iterations, run.objective, run.wall_time,
+            run.cpu_time);
+    for (Index i=0; i<(Index)task_names.size(); i++) {
+      fprintf(fp, ",%.6f", i<(Index)run.task_times.size() ? run.task_times[i] : 0.);
+    }
+    fprintf(fp, "\n");
+  }
+  fclose(fp);
+  return true;
+}
+
+/** Write the results in JSON format */
+static bool write_json(const char* filename,
+                       const vector<BenchmarkRun>& runs,
+                       const vector<string>& task_names)
+{
+  FILE* fp = fopen(filename, "w");
+  if (!fp) {
+    printf("Cannot open file \"%s\" for writing.\n", filename);
+    return false;
+  }
+  fprintf(fp, "[\n");
+  for (Index k=0; k<(Index)runs.size(); k++) {
+    const BenchmarkRun& run = runs[k];
+    fprintf(fp, "  {\"problem\": \"%s\", \"N\": %d, \"options\": {",
+            run.problem.c_str(), run.N);
+    for (Index i=0; i<(Index)run.options.size(); i++) {
+      fprintf(fp, "%s\"%s\": \"%s\"", i>0 ? ", " : "",
+              run.options[i].first.c_str(), run.options[i].second.c_str());
+    }
+    fprintf(fp, "},\n   \"status\": %d, \"iterations\": %d, \"objective\": %.16e,"
+            " \"wall_time\": %.6f, \"cpu_time\": %.6f,\n   \"tasks\": {",
+            run.status, run.iterations, run.objective, run.wall_time,
+            run.cpu_time);
+    for (Index i=0; i<(Index)run.task_times.size(); i++) {
+      fprintf(fp, "%s\"%s\": %.6f", i>0 ? ", " : "",
+              task_names[i].c_str(), run.task_times[i]);
+    }
+    fprintf(fp, "}}%s\n", k+1<(Index)runs.size() ? "," : "");
+  }
+  fprintf(fp, "]\n");
+  fclose(fp);
+  return true;
+}
+
+/** Read a baseline that has been written by write_csv */
+static bool read_baseline(const char* filename,
+                          map<string, BaselineRun>& baseline)
+{
+  ifstream is(filename);
+  if (!is) {
+    printf("Cannot open baseline file \"%s\".\n", filename);
+    return false;
+  }
+  string line;
+  if (!getline(is, line)) {
+    printf("Baseline file \"%s\" is empty.\n", filename);
+    return false;
+  }
+  vector<string> header = split(line, ',');
+  Index col_status = -1, col_iter = -1, col_time = -1;
+  for (Index i=0; i<(Index)header.size(); i++) {
+    if (header[i] == "status") {
+      col_status = i;
+    }
+    else if (header[i] == "iterations") {
+      col_iter = i;
+    }
+    else if (header[i] == "wall_time") {
+      col_time = i;
+    }
+  }
+  if (header.size() < 3 || col_status < 0 || col_iter < 0 || col_time < 0) {
+    printf("Baseline file \"%s\" does not have the expected columns.\n",
+           filename);
+    return false;
+  }
+  while (getline(is, line)) {
+    vector<string> fields = split(line, ',');
+    if (fields.size() != header.size()) {
+      continue;
+    }
+    BaselineRun base;
+    base.status = atoi(fields[col_status].c_str());
+    base.iterations = atoi(fields[col_iter].c_str());
+    base.wall_time = atof(fields[col_time].c_str());
+    baseline[fields[0] + "," + fields[1] + "," + fields[2]] = base;
+  }
+  return true;
+}
+
+static void print_usage(const char* exe)
+{
+  printf("Usage: %s SPECFILE [options]\n\n", exe);
+  printf("SPECFILE contains one line per group of runs:\n");
+  printf("  PROBLEM SIZES [OPTION=VALUES ...]\n");
+  printf("where PROBLEM, SIZES and VALUES can be comma separated lists, e.g.\n");
+  printf("  LukVlE1,LukVlI1 1000,10000 linear_solver=ma27,mumps\n\n");
+  printf("Options:\n");
+  printf("  -repeat K          solve each problem K times and take the fastest (1)\n");
+  printf("  -csv FILE          write results in CSV format\n");
+  printf("  -json FILE         write results in JSON format\n");
+  printf("  -baseline FILE     compare with results previously written with -csv\n");
+  printf("  -time_tol T        allowed relative increase of wall clock time (0.1)\n");
+  printf("  -min_time T        time differences below T seconds are ignored (0.01)\n");
+  printf("  -iter_tol K        allowed increase of the iteration count (0)\n\n");
+  printf("The return value is 1 if a regression compared to the baseline was found.\n");
+  printf("Use '%s list' to list all registered problems.\n", exe);
+}
+
+int main(int argv, char* argc[])
+{
+  if (argv==2 && !strcmp(argc[1],"list")) {
+    printf("\nList of all registered problems:\n\n");
+    RegisteredTNLPs::PrintRegisteredProblems();
+    return 0;
+  }
+  if (argv < 2 || argc[1][0] == '-') {
+    print_usage(argc[0]);
+    return -1;
+  }
+
+  const char* spec_file = argc[1];
+  const char* csv_file = NULL;
+  const char* json_file = NULL;
+  const char* baseline_file = NULL;
+  Index repeat = 1;
+  Number time_tol = 0.1;
+  Number min_time = 0.01;
+  Index iter_tol = 0;
+  for (int i=2; i<argv; i++) {
+    if (i+1 >= argv) {
+      print_usage(argc[0]);
+      return -1;
+    }
+    if (!strcmp(argc[i], "-repeat")) {
+      repeat = atoi(argc[++i]);
+    }
+    else if (!strcmp(argc[i], "-csv")) {
+      csv_file = argc[++i];
+    }
+    else if (!strcmp(argc[i], "-json")) {
+      json_file = argc[++i];
+    }
+    else if (!strcmp(argc[i], "-baseline")) {
+      baseline_file = argc[++i];
+    }
+    else if (!strcmp(argc[i], "-time_tol")) {
+      time_tol = atof(argc[++i]);
+    }
+    else if (!strcmp(argc[i], "-min_time")) {
+      min_time = atof(argc[++i]);
+    }
+    else if (!strcmp(argc[i], "-iter_tol")) {
+      iter_tol = atoi(argc[++i]);
+    }
+    else {
+      print_usage(argc[0]);
+      return -1;
+    }
+  }
+  if (repeat <= 0) {
+    printf("Number of repetitions must be positive.\n");
+    return -1;
+  }
+
+  vector<BenchmarkRun> runs;
+  if (!read_spec(spec_file, runs)) {
+    return -2;
+  }
+
+  map<string, BaselineRun> baseline;
+  if (baseline_file && !read_baseline(baseline_file, baseline)) {
+    return -2;
+  }
+
+  // names of the timed tasks
+  vector<string> task_names;
+  {
+    SmartPtr<TimingStatistics> timing = new TimingStatistics();
+    for (Index i=0; i<timing->NumberOfTasks(); i++) {
+      task_names.push_back(timing->Task(i).Name());
+    }
+  }
+
+  printf("%-16s %8s %-40s %6s %6s %10s %10s\n", "problem", "N", "options",
+         "status", "iter", "wall", "base");
+  Index n_regressions = 0;
+  for (Index k=0; k<(Index)runs.size(); k++) {
+    BenchmarkRun& run = runs[k];
+    do_run(run, repeat);
+
+    printf("%-16s %8d %-40s %6d %6d %10.3f", run.problem.c_str(), run.N,
+           run.OptionsString().c_str(), run.status, run.iterations,
+           run.wall_time);
+    if (baseline_file) {
+      map<string, BaselineRun>::iterator it = baseline.find(run.Key());
+      if (it == baseline.end()) {
+        printf(" %10s", "-");
+      }
+      else {
+        const BaselineRun& base = it->second;
+        printf(" %10.3f", base.wall_time);
+        if (base.status != run.status) {
+          printf("  REGRESSION: status %d (baseline %d)", run.status, base.status);
+          n_regressions++;
+        }
+        else if (run.iterations > base.iterations + iter_tol) {
+          printf("  REGRESSION: %d iterations (baseline %d)", run.iterations,
+                 base.iterations);
+          n_regressions++;
+        }
+        else if (run.wall_time > (1.+time_tol)*base.wall_time &&
+                 run.wall_time - base.wall_time > min_time) {
+          printf("  REGRESSION: %.1f%% slower", 100.*(run.wall_time/base.wall_time - 1.));
+          n_regressions++;
+        }
+      }
+    }
+    printf("\n");
+    fflush(stdout);
+  }
+
+  if (csv_file && !write_csv(csv_file, runs, task_names)) {
+    return -3;
+  }
+  if (json_file && !write_json(json_file, runs, task_names)) {
+    return -3;
+  }
+
+  if (baseline_file) {
+    printf("\n%d regression(s) compared to baseline \"%s\".\n", n_regressions,
+           baseline_file);
+  }
+  return n_regressions > 0 ? 1 : 0;
+}
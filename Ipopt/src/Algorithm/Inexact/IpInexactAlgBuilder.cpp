@@ -15,6 +15,7 @@
 
 #include "IpOptErrorConvCheck.hpp"
 #include "IpStdAugSystemSolver.hpp"
+#include "IpKrylovAugSystemSolver.hpp"
 #include "IpTSymLinearSolver.hpp"
 #include "IpPDPerturbationHandler.hpp"
 
@@ -41,7 +42,10 @@
 #include "IpMa57TSolverInterface.hpp"
 #include "IpMc19TSymScalingMethod.hpp"
 #include "IpInexactTSymScalingMethod.hpp"
-#include "IpIterativePardisoSolverInterface.hpp"
+#ifdef HAVE_PARDISO
+# include "IpIterativePardisoSolverInterface.hpp"
+#endif
+#include "IpIterativeSqmrSolverInterface.hpp"
 #include "IpInexactNormalTerminationTester.hpp"
 #include "IpInexactPDTerminationTester.hpp"
 
@@ -58,7 +62,6 @@
 
 #ifdef HAVE_LINEARSOLVERLOADER
 # include "HSLLoader.h"
-# include "PardisoLoader.h"
 #endif
 
 namespace Ipopt
@@ -126,9 +129,23 @@ namespace Ipopt
 
     SmartPtr<InexactNormalTerminationTester> NormalTester;
     SmartPtr<SparseSymLinearSolverInterface> SolverInterface;
+    std::string aug_system_solver;
+    options.GetStringValue("aug_system_solver", aug_system_solver, prefix);
+    bool hessian_vector_products;
+    options.GetBoolValue("hessian_vector_products", hessian_vector_products,
+                         prefix);
+    if (hessian_vector_products && aug_system_solver!="krylov") {
+      THROW_EXCEPTION(OPTION_INVALID,
+                      "The option hessian_vector_products requires aug_system_solver=krylov.");
+    }
     std::string linear_solver;
     options.GetStringValue("linear_solver", linear_solver, prefix);
-    if (linear_solver=="ma27") {
+    if (aug_system_solver=="krylov") {
+      // The augmented system is solved by MINRES, which only
+      // requires products with the matrices, so that no linear
+      // solver is needed
+    }
+    else if (linear_solver=="ma27") {
 #ifndef COINHSL_HAS_MA27
 # ifdef HAVE_LINEARSOLVERLOADER
       SolverInterface = new Ma27TSolverInterface();
@@ -173,30 +190,24 @@ namespace Ipopt
 
     }
     else if (linear_solver=="pardiso") {
+      // The iterative version of Pardiso needs the callback of a
+      // linked Pardiso library and cannot be loaded at runtime
+#ifdef HAVE_PARDISO
       NormalTester = new InexactNormalTerminationTester();
       SmartPtr<IterativeSolverTerminationTester> pd_tester =
         new InexactPDTerminationTester();
-#ifndef HAVE_PARDISO
-# ifdef HAVE_LINEARSOLVERLOADER
       SolverInterface = new IterativePardisoSolverInterface(*NormalTester, *pd_tester);
-      char buf[256];
-      int rc = LSL_loadPardisoLib(NULL, buf, 255);
-      if (rc) {
-        std::string errmsg;
-        errmsg = "Selected linear solver Pardiso not available.\nTried to obtain Pardiso from shared library \"";
-        errmsg += LSL_PardisoLibraryName();
-        errmsg += "\", but the following error occured:\n";
-        errmsg += buf;
-        THROW_EXCEPTION(OPTION_INVALID, errmsg.c_str());
-      }
-# else
-      THROW_EXCEPTION(OPTION_INVALID, "Support for Pardiso has not been compiled into Ipopt.");
-# endif
 #else
-      SolverInterface = new IterativePardisoSolverInterface(*NormalTester, *pd_tester);
+      THROW_EXCEPTION(OPTION_INVALID, "The inexact algorithm requires Ipopt to be compiled with Pardiso for linear_solver=pardiso; use linear_solver=sqmr instead.");
 #endif
 
     }
+    else if (linear_solver=="sqmr") {
+      NormalTester = new InexactNormalTerminationTester();
+      SmartPtr<IterativeSolverTerminationTester> pd_tester =
+        new InexactPDTerminationTester();
+      SolverInterface = new IterativeSqmrSolverInterface(*NormalTester, *pd_tester);
+    }
     else if (linear_solver=="wsmp") {
 #ifdef HAVE_WSMP
       SolverInterface = new WsmpSolverInterface();
@@ -222,20 +233,25 @@ namespace Ipopt
                       "Inexact version not available for this selection of linear solver.");
     }
 
-    SmartPtr<TSymScalingMethod> ScalingMethod;
-
-    std::string inexact_linear_system_scaling;
-    options.GetStringValue("inexact_linear_system_scaling",
-                           inexact_linear_system_scaling, prefix);
-    if (inexact_linear_system_scaling=="slack-based") {
-      ScalingMethod = new InexactTSymScalingMethod();
+    SmartPtr<AugSystemSolver> AugSolver;
+    if (aug_system_solver=="krylov") {
+      AugSolver = new KrylovAugSystemSolver();
     }
+    else {
+      SmartPtr<TSymScalingMethod> ScalingMethod;
 
-    SmartPtr<SymLinearSolver> ScaledSolver =
-      new TSymLinearSolver(SolverInterface, ScalingMethod);
+      std::string inexact_linear_system_scaling;
+      options.GetStringValue("inexact_linear_system_scaling",
+                             inexact_linear_system_scaling, prefix);
+      if (inexact_linear_system_scaling=="slack-based") {
+        ScalingMethod = new InexactTSymScalingMethod();
+      }
+
+      SmartPtr<SymLinearSolver> ScaledSolver =
+        new TSymLinearSolver(SolverInterface, ScalingMethod);
 
-    SmartPtr<AugSystemSolver> AugSolver =
-      new StdAugSystemSolver(*ScaledSolver);
+      AugSolver = new StdAugSystemSolver(*ScaledSolver);
+    }
 
     // Create the object for initializing the iterates Initialization
     // object.  We include both the warm start and the defaut
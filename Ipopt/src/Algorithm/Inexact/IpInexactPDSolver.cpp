@@ -75,7 +75,10 @@ namespace Ipopt
 
     std::string linear_solver;
     options.GetStringValue("linear_solver", linear_solver, prefix);
-    is_pardiso_ = (linear_solver=="pardiso");
+    std::string aug_system_solver;
+    options.GetStringValue("aug_system_solver", aug_system_solver, prefix);
+    is_pardiso_ = (aug_system_solver!="krylov" &&
+                   (linear_solver=="pardiso" || linear_solver=="sqmr"));
 
     if (!augSysSolver_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
                                    options, prefix)) {
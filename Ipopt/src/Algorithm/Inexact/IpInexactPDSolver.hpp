@@ -130,7 +130,8 @@ namespace Ipopt
     Index inexact_regularization_ls_count_trigger_;
     //@}
 
-    /** flag indicating if we are dealing with the Pardiso solver
+    /** flag indicating if we are dealing with an iterative solver
+     *  that runs the termination tests (Pardiso or SQMR)
      *  (temporary) */
     bool is_pardiso_;
 
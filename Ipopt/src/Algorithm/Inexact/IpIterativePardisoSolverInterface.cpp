@@ -45,7 +45,6 @@
 
 
 Ipopt::IterativeSolverTerminationTester* global_tester_ptr_;
-Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
 extern "C"
 {
   int IpoptTerminationTest(int n, double* sol, double* resid, int iter, double norm2_rhs) {
@@ -9,6 +9,8 @@
 #include "IpIterativeSolverTerminationTester.hpp"
 #include "IpTripletHelper.hpp"
 
+Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+
 namespace Ipopt
 {
 
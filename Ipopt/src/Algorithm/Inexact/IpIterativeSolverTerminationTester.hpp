@@ -126,4 +126,8 @@ namespace Ipopt
 
 } // namespace Ipopt
 
+/** Result of the most recent termination test of the iterative
+ *  linear solver for the primal-dual system */
+extern Ipopt::IterativeSolverTerminationTester::ETerminationTest test_result_;
+
 #endif
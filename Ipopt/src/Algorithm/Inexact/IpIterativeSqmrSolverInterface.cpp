@@ -0,0 +1,467 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpoptConfig.h"
+#include "IpIterativeSqmrSolverInterface.hpp"
+#include "IpBlas.hpp"
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  IterativeSqmrSolverInterface::
+  IterativeSqmrSolverInterface(IterativeSolverTerminationTester& normal_tester,
+                               IterativeSolverTerminationTester& pd_tester)
+      :
+      dim_(0),
+      nonzeros_(0),
+      a_(NULL),
+      negevals_(-1),
+      initialized_(false),
+      normal_tester_(&normal_tester),
+      pd_tester_(&pd_tester)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::IterativeSqmrSolverInterface()",dbg_verbosity);
+  }
+
+  IterativeSqmrSolverInterface::~IterativeSqmrSolverInterface()
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::~IterativeSqmrSolverInterface()",
+                   dbg_verbosity);
+    delete[] a_;
+  }
+
+  void IterativeSqmrSolverInterface::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddLowerBoundedIntegerOption(
+      "sqmr_max_iter",
+      "Maximum number of SQMR iterations.",
+      1, 500,
+      "This is the maximal number of iterations of the built-in SQMR solver "
+      "(linear_solver = sqmr) per solve.  For the normal step computation, "
+      "the value of \"normal.sqmr_max_iter\" is used.");
+    roptions->AddBoundedNumberOption(
+      "sqmr_iter_relative_tol",
+      "Relative residual tolerance of the SQMR solver.",
+      0.0, true, 1.0, true, 1e-6,
+      "The SQMR iterations are stopped if the norm of the residual relative "
+      "to the norm of the right hand side is below this value, even if the "
+      "termination tests of the inexact algorithm are not yet satisfied.  "
+      "For the normal step computation, the value of "
+      "\"normal.sqmr_iter_relative_tol\" is used.");
+    roptions->AddLowerBoundedNumberOption(
+      "sqmr_ildl_pivot_tol",
+      "Relative pivot tolerance for the incomplete LDL^T preconditioner.",
+      0.0, false, 1e-8,
+      "A pivot of the incomplete factorization that is smaller in absolute "
+      "value than this factor times the largest absolute element in the "
+      "corresponding row of the matrix is replaced by this product (with "
+      "the sign of the pivot).");
+  }
+
+  bool IterativeSqmrSolverInterface::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetIntegerValue("sqmr_max_iter", sqmr_max_iter_, prefix);
+    options.GetNumericValue("sqmr_iter_relative_tol",
+                            sqmr_iter_relative_tol_, prefix);
+    options.GetIntegerValue("sqmr_max_iter", normal_sqmr_max_iter_,
+                            prefix+"normal.");
+    options.GetNumericValue("sqmr_iter_relative_tol",
+                            normal_sqmr_iter_relative_tol_, prefix+"normal.");
+    options.GetNumericValue("sqmr_ildl_pivot_tol", sqmr_ildl_pivot_tol_,
+                            prefix);
+
+    // Reset all private data
+    dim_=0;
+    nonzeros_=0;
+    initialized_=false;
+    delete[] a_;
+    a_ = NULL;
+
+    bool retval = normal_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                  IpCq(), options, prefix);
+    if (retval) {
+      retval = pd_tester_->Initialize(Jnlst(), IpNLP(), IpData(),
+                                      IpCq(), options, prefix);
+    }
+
+    return retval;
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::InitializeStructure(
+    Index dim, Index nonzeros,
+    const Index* ia,
+    const Index* ja)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::InitializeStructure",dbg_verbosity);
+    dim_ = dim;
+    nonzeros_ = nonzeros;
+
+    // Make space for storing the matrix elements
+    delete[] a_;
+    a_ = NULL;
+    a_ = new double[nonzeros_];
+
+    // Find the diagonal elements.  The matrix is given as the upper
+    // triangular part in compressed row format.
+    diag_pos_.assign(dim_, -1);
+    for (Index i=0; i<dim_; i++) {
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        if (ja[p] == i) {
+          diag_pos_[i] = p;
+          break;
+        }
+      }
+    }
+
+    l_.resize(nonzeros_);
+    d_.resize(dim_);
+    pos_.assign(dim_, -1);
+
+    initialized_ = true;
+
+    return SYMSOLVER_SUCCESS;
+  }
+
+  double* IterativeSqmrSolverInterface::GetValuesArrayPtr()
+  {
+    DBG_ASSERT(initialized_);
+    DBG_ASSERT(a_);
+    return a_;
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::MultiSolve(bool new_matrix,
+      const Index* ia,
+      const Index* ja,
+      Index nrhs,
+      double* rhs_vals,
+      bool check_NegEVals,
+      Index numberOfNegEVals)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(!check_NegEVals || ProvidesInertia());
+    DBG_ASSERT(initialized_);
+
+    if (new_matrix) {
+      if (HaveIpData()) {
+        IpData().TimingStats().LinearSystemFactorization().Start();
+      }
+      Factorization(ia, ja);
+      if (HaveIpData()) {
+        IpData().TimingStats().LinearSystemFactorization().End();
+      }
+    }
+
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemBackSolve().Start();
+    }
+    ESymSolverStatus retval = SYMSOLVER_SUCCESS;
+    for (Index irhs=0; irhs<nrhs && retval==SYMSOLVER_SUCCESS; irhs++) {
+      retval = Solve(ia, ja, rhs_vals + irhs*dim_);
+    }
+    if (HaveIpData()) {
+      IpData().TimingStats().LinearSystemBackSolve().End();
+    }
+
+    return retval;
+  }
+
+  void IterativeSqmrSolverInterface::Factorization(const Index* ia,
+      const Index* ja)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::Factorization",dbg_verbosity);
+
+    // Largest absolute element in each row of the full matrix, used
+    // for the pivot tolerance
+    std::vector<Number> rowmax(dim_, 0.);
+    for (Index i=0; i<dim_; i++) {
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        const Number aval = fabs(a_[p]);
+        rowmax[i] = Max(rowmax[i], aval);
+        rowmax[ja[p]] = Max(rowmax[ja[p]], aval);
+      }
+    }
+
+    // Initialize the factor with the matrix elements; the updates
+    // are then applied right-looking, dropping everything that is not
+    // in the sparsity pattern
+    for (Index i=0; i<dim_; i++) {
+      d_[i] = (diag_pos_[i] >= 0) ? a_[diag_pos_[i]] : 0.;
+    }
+    IpBlasDcopy(nonzeros_, a_, 1, &l_[0], 1);
+
+    negevals_ = 0;
+    Index nperturbed = 0;
+    for (Index k=0; k<dim_; k++) {
+      Number dk = d_[k];
+      const Number pivmin = sqmr_ildl_pivot_tol_*rowmax[k];
+      if (rowmax[k] == 0.) {
+        dk = 1.;
+        nperturbed++;
+      }
+      else if (fabs(dk) <= pivmin) {
+        dk = (dk < 0.) ? -pivmin : pivmin;
+        nperturbed++;
+      }
+      d_[k] = dk;
+      if (dk < 0.) {
+        negevals_++;
+      }
+
+      // Column k of L
+      for (Index p=ia[k]; p<ia[k+1]; p++) {
+        if (ja[p] != k) {
+          l_[p] /= dk;
+        }
+      }
+
+      // Update the remaining part of the matrix with the outer
+      // product of column k of L, restricted to the sparsity pattern
+      for (Index p1=ia[k]; p1<ia[k+1]; p1++) {
+        const Index j1 = ja[p1];
+        if (j1 == k) {
+          continue;
+        }
+        const Number lfac = l_[p1]*dk;
+        d_[j1] -= lfac*l_[p1];
+        for (Index q=ia[j1]; q<ia[j1+1]; q++) {
+          pos_[ja[q]] = q;
+        }
+        for (Index p2=ia[k]; p2<ia[k+1]; p2++) {
+          const Index j2 = ja[p2];
+          if (j2 > j1 && pos_[j2] >= 0) {
+            l_[pos_[j2]] -= lfac*l_[p2];
+          }
+        }
+        for (Index q=ia[j1]; q<ia[j1+1]; q++) {
+          pos_[ja[q]] = -1;
+        }
+      }
+    }
+
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Incomplete LDL^T factorization: %d negative and %d perturbed pivots.\n",
+                   negevals_, nperturbed);
+    if (nperturbed > 0 && HaveIpData()) {
+      IpData().Append_info_string("Pp");
+    }
+  }
+
+  void IterativeSqmrSolverInterface::MultMatrix(const Index* ia,
+      const Index* ja,
+      const Number* x,
+      Number* y) const
+  {
+    for (Index i=0; i<dim_; i++) {
+      y[i] = 0.;
+    }
+    for (Index i=0; i<dim_; i++) {
+      const Number xi = x[i];
+      Number yi = 0.;
+      for (Index p=ia[i]; p<ia[i+1]; p++) {
+        const Index j = ja[p];
+        yi += a_[p]*x[j];
+        if (j != i) {
+          y[j] += a_[p]*xi;
+        }
+      }
+      y[i] += yi;
+    }
+  }
+
+  void IterativeSqmrSolverInterface::ApplyPreconditioner(const Index* ia,
+      const Index* ja,
+      Number* z) const
+  {
+    // Forward solve with L and D
+    for (Index k=0; k<dim_; k++) {
+      const Number zk = z[k];
+      for (Index p=ia[k]; p<ia[k+1]; p++) {
+        if (ja[p] != k) {
+          z[ja[p]] -= l_[p]*zk;
+        }
+      }
+      z[k] = zk/d_[k];
+    }
+    // Backward solve with L^T
+    for (Index k=dim_-1; k>=0; k--) {
+      Number zk = z[k];
+      for (Index p=ia[k]; p<ia[k+1]; p++) {
+        if (ja[p] != k) {
+          zk -= l_[p]*z[ja[p]];
+        }
+      }
+      z[k] = zk;
+    }
+  }
+
+  ESymSolverStatus IterativeSqmrSolverInterface::Solve(const Index* ia,
+      const Index* ja,
+      double *rhs_vals)
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::Solve",dbg_verbosity);
+
+    const Index n = dim_;
+    IterativeSolverTerminationTester* tester;
+    bool is_normal = false;
+    if (IsNull(InexData().normal_x()) && InexData().compute_normal()) {
+      tester = GetRawPtr(normal_tester_);
+      is_normal = true;
+    }
+    else {
+      tester = GetRawPtr(pd_tester_);
+    }
+    const Index max_iter = is_normal ? normal_sqmr_max_iter_ : sqmr_max_iter_;
+    const Number rel_tol =
+      is_normal ? normal_sqmr_iter_relative_tol_ : sqmr_iter_relative_tol_;
+
+    test_result_ = IterativeSolverTerminationTester::CONTINUE;
+
+    // Work vectors: x is the iterate, resid the true residual b-A*x,
+    // r the residual of the underlying Lanczos process, s = A*d
+    std::vector<Number> x(n, 0.);
+    std::vector<Number> resid(rhs_vals, rhs_vals+n);
+    std::vector<Number> r(rhs_vals, rhs_vals+n);
+    std::vector<Number> q(rhs_vals, rhs_vals+n);
+    std::vector<Number> d(n, 0.);
+    std::vector<Number> s(n, 0.);
+    std::vector<Number> t(n);
+
+    const Number norm2_rhs = IpBlasDnrm2(n, rhs_vals, 1);
+    if (norm2_rhs == 0.) {
+      // Nothing to do, the solution is zero (and rhs_vals is already
+      // zero)
+      return SYMSOLVER_SUCCESS;
+    }
+
+    bool retval = tester->InitializeSolve();
+    ASSERT_EXCEPTION(retval, INTERNAL_ABORT, "tester->InitializeSolve(); returned false");
+
+    ApplyPreconditioner(ia, ja, &q[0]);
+    Number tau = norm2_rhs;
+    Number theta = 0.;
+    Number rho = IpBlasDdot(n, &r[0], 1, &q[0], 1);
+
+    Index iter = 0;
+    bool breakdown = false;
+    Number norm2_resid = norm2_rhs;
+    while (true) {
+      if (rho == 0.) {
+        breakdown = true;
+        break;
+      }
+      MultMatrix(ia, ja, &q[0], &t[0]);
+      const Number sigma = IpBlasDdot(n, &q[0], 1, &t[0], 1);
+      if (sigma == 0.) {
+        breakdown = true;
+        break;
+      }
+      const Number alpha = rho/sigma;
+      IpBlasDaxpy(n, -alpha, &t[0], 1, &r[0], 1);
+
+      const Number theta_new = IpBlasDnrm2(n, &r[0], 1)/tau;
+      const Number c2 = 1./(1. + theta_new*theta_new);
+      tau *= theta_new*sqrt(c2);
+
+      // d = c^2*theta^2*d + c^2*alpha*q, and the same for s = A*d
+      IpBlasDscal(n, c2*theta*theta, &d[0], 1);
+      IpBlasDaxpy(n, c2*alpha, &q[0], 1, &d[0], 1);
+      IpBlasDscal(n, c2*theta*theta, &s[0], 1);
+      IpBlasDaxpy(n, c2*alpha, &t[0], 1, &s[0], 1);
+      theta = theta_new;
+
+      IpBlasDaxpy(n, 1., &d[0], 1, &x[0], 1);
+      IpBlasDaxpy(n, -1., &s[0], 1, &resid[0], 1);
+      iter++;
+
+      test_result_ = tester->TestTermination(n, &x[0], &resid[0], iter,
+                                             norm2_rhs);
+      Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
+                     "Termination Tester Result = %d.\n", test_result_);
+      if (test_result_ != IterativeSolverTerminationTester::CONTINUE) {
+        break;
+      }
+      norm2_resid = IpBlasDnrm2(n, &resid[0], 1);
+      if (norm2_resid <= rel_tol*norm2_rhs || iter >= max_iter) {
+        break;
+      }
+
+      // Next Lanczos vector
+      IpBlasDcopy(n, &r[0], 1, &t[0], 1);
+      ApplyPreconditioner(ia, ja, &t[0]);
+      const Number rho_new = IpBlasDdot(n, &r[0], 1, &t[0], 1);
+      const Number beta = rho_new/rho;
+      IpBlasDscal(n, beta, &q[0], 1);
+      IpBlasDaxpy(n, 1., &t[0], 1, &q[0], 1);
+      rho = rho_new;
+    }
+
+    Index iterations_used = tester->GetSolverIterations();
+    tester->Clear();
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Number of iterations in SQMR solver for %s step = %d (relative residual %e).\n",
+                   is_normal ? "normal" : "PD", iterations_used,
+                   norm2_resid/norm2_rhs);
+
+    IpBlasDcopy(n, &x[0], 1, rhs_vals, 1);
+
+    if (test_result_ == IterativeSolverTerminationTester::MODIFY_HESSIAN) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Termination tester requests modification of Hessian\n");
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+    if (test_result_ == IterativeSolverTerminationTester::CONTINUE) {
+      if (breakdown && norm2_resid > rel_tol*norm2_rhs) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Breakdown in SQMR solver after %d iterations.  Pretend singular\n", iter);
+        return SYMSOLVER_SINGULAR;
+      }
+      if (iter >= max_iter) {
+        Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
+                       "SQMR solver did not converge within %d iterations (relative residual %e)\n",
+                       max_iter, norm2_resid/norm2_rhs);
+        if (HaveIpData()) {
+          IpData().Append_info_string("Mi");
+        }
+      }
+    }
+    if (test_result_ == IterativeSolverTerminationTester::TEST_2_SATISFIED) {
+      // Termination Test 2 is satisfied, set the step for the primal
+      // iterates to zero
+      Index nvars = IpData().curr()->x()->Dim() + IpData().curr()->s()->Dim();
+      const Number zero = 0.;
+      IpBlasDcopy(nvars, &zero, 0, rhs_vals, 1);
+    }
+    return SYMSOLVER_SUCCESS;
+  }
+
+  Index IterativeSqmrSolverInterface::NumberOfNegEVals() const
+  {
+    DBG_START_METH("IterativeSqmrSolverInterface::NumberOfNegEVals",dbg_verbosity);
+    DBG_ASSERT(negevals_>=0);
+    return negevals_;
+  }
+
+  bool IterativeSqmrSolverInterface::IncreaseQuality()
+  {
+    return false;
+  }
+
+} // namespace Ipopt
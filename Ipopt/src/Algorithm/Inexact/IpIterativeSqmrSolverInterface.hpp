@@ -0,0 +1,221 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IPITERATIVESQMRSOLVERINTERFACE_HPP__
+#define __IPITERATIVESQMRSOLVERINTERFACE_HPP__
+
+#include "IpSparseSymLinearSolverInterface.hpp"
+#include "IpInexactCq.hpp"
+#include "IpIterativeSolverTerminationTester.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+
+  /** Built-in iterative linear solver for the inexact algorithm,
+   *  derived from SparseSymLinearSolverInterface.  It does not
+   *  require any third party library, so that the inexact algorithm
+   *  can be used without the iterative version of Pardiso.
+   *
+   *  The system is solved with the symmetric QMR method (SQMR) of
+   *  Freund and Nachtigal, preconditioned by an incomplete
+   *  \f$LDL^T\f$ factorization without fill-in (on the sparsity
+   *  pattern of the matrix, in the given ordering).  Pivots that are
+   *  too small compared to the corresponding row of the matrix are
+   *  replaced by a multiple of \f$\mbox{sqmr\_ildl\_pivot\_tol}\f$
+   *  times the row norm.
+   *
+   *  As for IterativePardisoSolverInterface, the iterations are
+   *  stopped as soon as the termination tester for the normal step
+   *  or for the primal-dual step is satisfied, or if the relative
+   *  residual drops below sqmr_iter_relative_tol.  The result of the
+   *  most recent termination test is stored in the same global
+   *  variable, so that InexactPDSolver can inspect it.
+   */
+  class IterativeSqmrSolverInterface: public SparseSymLinearSolverInterface
+  {
+  public:
+    /** @name Constructor/Destructor */
+    //@{
+    /** Constructor */
+    IterativeSqmrSolverInterface(IterativeSolverTerminationTester& normal_tester,
+                                 IterativeSolverTerminationTester& pd_tester);
+
+    /** Destructor */
+    virtual ~IterativeSqmrSolverInterface();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+
+    /** @name Methods for requesting solution of the linear system. */
+    //@{
+    /** Method for initializing internal stuctures. */
+    virtual ESymSolverStatus InitializeStructure(Index dim, Index nonzeros,
+        const Index *ia,
+        const Index *ja);
+
+    /** Method returing an internal array into which the nonzero
+     *  elements are to be stored. */
+    virtual double* GetValuesArrayPtr();
+
+    /** Solve operation for multiple right hand sides. */
+    virtual ESymSolverStatus MultiSolve(bool new_matrix,
+                                        const Index* ia,
+                                        const Index* ja,
+                                        Index nrhs,
+                                        double* rhs_vals,
+                                        bool check_NegEVals,
+                                        Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last
+     *  factorization.  This is only the number of negative pivots of
+     *  the incomplete factorization. */
+    virtual Index NumberOfNegEVals() const;
+    //@}
+
+    //* @name Options of Linear solver */
+    //@{
+    /** Request to increase quality of solution for next solve.
+     *  This is not supported, the method always returns false. */
+    virtual bool IncreaseQuality();
+
+    /** Query whether inertia is computed by linear solver.  The
+     *  incomplete factorization does not give the inertia of the
+     *  matrix, so this is false. */
+    virtual bool ProvidesInertia() const
+    {
+      return false;
+    }
+    /** Query of requested matrix type that the linear solver
+     *  understands.
+     */
+    EMatrixFormat MatrixFormat() const
+    {
+      return CSR_Format_0_Offset;
+    }
+    //@}
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    IterativeSqmrSolverInterface();
+
+    /** Copy Constructor */
+    IterativeSqmrSolverInterface(const IterativeSqmrSolverInterface&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const IterativeSqmrSolverInterface&);
+    //@}
+
+    /** @name Information about the matrix */
+    //@{
+    /** Number of rows and columns of the matrix */
+    Index dim_;
+
+    /** Number of nonzeros of the matrix in CSR representation. */
+    Index nonzeros_;
+
+    /** Array for storing the values of the matrix. */
+    double* a_;
+
+    /** Position of the diagonal element of each row in a_, or -1 if
+     *  the diagonal element is not in the sparsity pattern */
+    std::vector<Index> diag_pos_;
+    //@}
+
+    /** @name Incomplete factorization */
+    //@{
+    /** Off-diagonal elements of L, on the sparsity pattern of a_ (the
+     *  elements of row i of the upper triangular part of the matrix
+     *  are column i of L) */
+    std::vector<Number> l_;
+    /** Pivots D */
+    std::vector<Number> d_;
+    /** Work space for the factorization: position of the elements
+     *  of a row in a_, indexed by column */
+    std::vector<Index> pos_;
+    /** Number of negative pivots */
+    Index negevals_;
+    //@}
+
+    /** @name Solver specific options */
+    //@{
+    /** Maximal number of SQMR iterations for the PD system */
+    Index sqmr_max_iter_;
+    /** Relative residual tolerance for the PD system */
+    Number sqmr_iter_relative_tol_;
+    /** Maximal number of SQMR iterations for the normal system */
+    Index normal_sqmr_max_iter_;
+    /** Relative residual tolerance for the normal system */
+    Number normal_sqmr_iter_relative_tol_;
+    /** Relative pivot tolerance of the incomplete factorization */
+    Number sqmr_ildl_pivot_tol_;
+    //@}
+
+    /** Flag indicating if internal data is initialized.
+     *  For initialization, this object needs to have seen a matrix */
+    bool initialized_;
+
+    /** @name Internal functions */
+    //@{
+    /** Compute the incomplete factorization of the matrix. */
+    void Factorization(const Index* ia,
+                       const Index* ja);
+
+    /** Solve for one right hand side with SQMR.  The right hand side
+     *  is overwritten by the solution. */
+    ESymSolverStatus Solve(const Index* ia,
+                           const Index* ja,
+                           double *rhs_vals);
+
+    /** Compute y = A*x */
+    void MultMatrix(const Index* ia,
+                    const Index* ja,
+                    const Number* x,
+                    Number* y) const;
+
+    /** Apply the preconditioner, z = (LDL^T)^{-1}*z */
+    void ApplyPreconditioner(const Index* ia,
+                             const Index* ja,
+                             Number* z) const;
+    //@}
+
+    /** Method to easily access Inexact data */
+    InexactData& InexData()
+    {
+      InexactData& inexact_data =
+        static_cast<InexactData&>(IpData().AdditionalData());
+      DBG_ASSERT(dynamic_cast<InexactData*>(&IpData().AdditionalData()));
+      return inexact_data;
+    }
+
+    /** Termination tester for normal step computation */
+    SmartPtr<IterativeSolverTerminationTester> normal_tester_;
+
+    /** Termination tester for primal-dual step computation */
+    SmartPtr<IterativeSolverTerminationTester> pd_tester_;
+
+  };
+
+} // namespace Ipopt
+#endif
@@ -16,6 +16,10 @@
 #include "IpCGPenaltyCq.hpp"
 
 #include "IpStdAugSystemSolver.hpp"
+#include "IpBlockSchurAugSystemSolver.hpp"
+#include "IpDenseAugSystemSolver.hpp"
+#include "IpCondensedAugSystemSolver.hpp"
+#include "IpKrylovAugSystemSolver.hpp"
 #include "IpAugRestoSystemSolver.hpp"
 #include "IpPDFullSpaceSolver.hpp"
 #include "IpPDPerturbationHandler.hpp"
@@ -83,6 +87,30 @@ namespace Ipopt
   static const Index dbg_verbosity = 0;
 #endif
 
+  /** Creates the StdAugSystemSolver for aug_system_solver=auto once
+   *  DenseAugSystemSolver has found the augmented system too large or
+   *  too sparse.  The linear solver is obtained from a new
+   *  AlgorithmBuilder, since a reference to the builder of the
+   *  algorithm would create a cycle of smart pointers. */
+  class StdAugSystemSolverCreator : public SparseAugSystemSolverCreator
+  {
+  public:
+    StdAugSystemSolverCreator()
+    {}
+
+    virtual ~StdAugSystemSolverCreator()
+    {}
+
+    virtual SmartPtr<AugSystemSolver> CreateSparseSolver(
+      const Journalist& jnlst,
+      const OptionsList& options,
+      const std::string& prefix)
+    {
+      SmartPtr<AlgorithmBuilder> builder = new AlgorithmBuilder();
+      return new StdAugSystemSolver(*builder->GetSymLinearSolver(jnlst, options, prefix));
+    }
+  };
+
   AlgorithmBuilder::AlgorithmBuilder(SmartPtr<AugSystemSolver> custom_solver /*=NULL*/)
       :
       custom_solver_(custom_solver)
@@ -91,7 +119,7 @@ namespace Ipopt
   void AlgorithmBuilder::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
   {
     roptions->SetRegisteringCategory("Linear Solver");
-    roptions->AddStringOption9(
+    roptions->AddStringOption10(
       "linear_solver",
       "Linear solver used for step computations.",
 #ifdef COINHSL_HAS_MA27
@@ -135,6 +163,7 @@ namespace Ipopt
       "pardiso", "use the Pardiso package",
       "wsmp", "use WSMP package",
       "mumps", "use MUMPS package",
+      "sqmr", "use the built-in SQMR iterative solver (only for the inexact algorithm)",
       "custom", "use custom linear solver",
       "Determines which linear algebra package is to be used for the "
       "solution of the augmented linear system (for obtaining the search "
@@ -160,6 +189,33 @@ namespace Ipopt
       "of the NLP problem scaling.  By default, MC19 is only used if MA27 or "
       "MA57 are selected as linear solvers. This value is only available if "
       "Ipopt has been compiled with MC19.");
+    roptions->AddStringOption6(
+      "aug_system_solver",
+      "Method for solving the augmented system.",
+      "auto",
+      "standard", "pass the complete augmented system to the linear solver",
+      "block-schur", "eliminate the coupling part of a block-bordered system by a Schur complement",
+      "dense", "factorize the augmented system as a dense matrix with LAPACK",
+      "condensed", "eliminate slacks and inequality multipliers and factorize the condensed system with LAPACK",
+      "krylov", "solve the augmented system iteratively with preconditioned MINRES",
+      "auto", "use \"dense\" for small dense systems, and \"standard\" otherwise",
+      "Determines how the augmented linear system is solved.  For "
+      "\"block-schur\", the variables must be assigned to blocks through "
+      "the meta data selected by \"block_schur_metadata_tag\"; the blocks "
+      "are factorized with the chosen linear solver, and the dense Schur "
+      "complement of the coupling variables and constraints with LAPACK.  "
+      "For \"auto\", the dense factorization is chosen if the augmented "
+      "system satisfies the criteria given by \"dense_aug_system_max_dim\" "
+      "and \"dense_aug_system_min_density\", unless \"linear_solver\" has "
+      "been set explicitly.  "
+      "\"condensed\" is meant for problems with few variables and equality "
+      "constraints, but many inequality constraints; the dimension of the "
+      "factorized dense matrix is the number of variables plus the number "
+      "of equality constraints.  "
+      "\"krylov\" requires only products with the derivative matrices and "
+      "no factorization, but it does not provide the inertia of the "
+      "augmented system (see \"krylov_tol\" and \"krylov_max_iter\").  "
+      "This option is ignored if \"linear_solver\" is \"custom\".");
 
     roptions->SetRegisteringCategory("NLP Scaling");
     roptions->AddStringOption4(
@@ -424,6 +480,10 @@ namespace Ipopt
 #endif
 
     }
+    else if (linear_solver=="sqmr") {
+      THROW_EXCEPTION(OPTION_INVALID,
+                      "Linear solver SQMR can only be used with the inexact algorithm (inexact_algorithm yes).");
+    }
     else if (linear_solver=="custom") {
       SolverInterface = NULL;
     }
@@ -487,14 +547,48 @@ namespace Ipopt
   {
     SmartPtr<AugSystemSolver> AugSolver;
     std::string linear_solver;
-    options.GetStringValue("linear_solver", linear_solver, prefix);
+    bool linear_solver_set =
+      options.GetStringValue("linear_solver", linear_solver, prefix);
     if (linear_solver=="custom") {
       ASSERT_EXCEPTION(IsValid(custom_solver_), OPTION_INVALID,
                        "Selected linear solver CUSTOM not available.");
       AugSolver = custom_solver_;
     }
     else {
-      AugSolver = new StdAugSystemSolver(*GetSymLinearSolver(jnlst, options, prefix));
+      std::string aug_system_solver;
+      options.GetStringValue("aug_system_solver", aug_system_solver, prefix);
+      bool hessian_vector_products;
+      options.GetBoolValue("hessian_vector_products", hessian_vector_products,
+                           prefix);
+      std::string hessian_approximation;
+      options.GetStringValue("hessian_approximation", hessian_approximation,
+                             prefix);
+      if (hessian_vector_products && hessian_approximation=="exact" &&
+          aug_system_solver!="krylov") {
+        THROW_EXCEPTION(OPTION_INVALID,
+                        "The option hessian_vector_products requires aug_system_solver=krylov.");
+      }
+      if (aug_system_solver=="block-schur") {
+        AugSolver = new BlockSchurAugSystemSolver(*GetSymLinearSolver(jnlst, options, prefix));
+      }
+      else if (aug_system_solver=="dense") {
+        AugSolver = new DenseAugSystemSolver();
+      }
+      else if (aug_system_solver=="condensed") {
+        AugSolver = new CondensedAugSystemSolver();
+      }
+      else if (aug_system_solver=="krylov") {
+        AugSolver = new KrylovAugSystemSolver();
+      }
+      else if (aug_system_solver=="auto" && !linear_solver_set) {
+        // The sparse linear solver is only created if the dense
+        // factorization is not chosen for the augmented system
+        AugSolver = new DenseAugSystemSolver(new StdAugSystemSolverCreator());
+      }
+      else {
+        // An explicitly chosen linear solver is always used
+        AugSolver = new StdAugSystemSolver(*GetSymLinearSolver(jnlst, options, prefix));
+      }
     }
 
     Index enum_int;
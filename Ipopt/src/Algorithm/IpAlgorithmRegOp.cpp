@@ -12,7 +12,10 @@
 #include "IpAdaptiveMuUpdate.hpp"
 #include "IpAlgBuilder.hpp"
 #include "IpDefaultIterateInitializer.hpp"
+#include "IpDenseAugSystemSolver.hpp"
+#include "IpKrylovAugSystemSolver.hpp"
 #include "IpBacktrackingLineSearch.hpp"
+#include "IpBlockSchurAugSystemSolver.hpp"
 #include "IpFilterLSAcceptor.hpp"
 #include "IpGradientScaling.hpp"
 #include "IpEquilibrationScaling.hpp"
@@ -50,6 +53,11 @@ namespace Ipopt
     DefaultIterateInitializer::RegisterOptions(roptions);
     roptions->SetRegisteringCategory("Main Algorithm");
     AlgorithmBuilder::RegisterOptions(roptions);
+    roptions->SetRegisteringCategory("Linear Solver");
+    BlockSchurAugSystemSolver::RegisterOptions(roptions);
+    roptions->SetRegisteringCategory("Linear Solver");
+    DenseAugSystemSolver::RegisterOptions(roptions);
+    KrylovAugSystemSolver::RegisterOptions(roptions);
     roptions->SetRegisteringCategory("Line Search");
     BacktrackingLineSearch::RegisterOptions(roptions);
     roptions->SetRegisteringCategory("Line Search");
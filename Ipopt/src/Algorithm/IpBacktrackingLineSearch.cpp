@@ -770,6 +770,13 @@ namespace Ipopt
           }
         }
 
+        // Do not spend more time on backtracking if the wallclock
+        // time limit has been reached
+        if (IpData().WallclockTimeExceeded()) {
+          THROW_EXCEPTION(WALLTIME_LIMIT_REACHED,
+                          "Maximal wallclock time exceeded in line search.");
+        }
+
         // Point is not yet acceptable, try a shorter one
         alpha_primal *= alpha_red_factor_;
         n_steps++;
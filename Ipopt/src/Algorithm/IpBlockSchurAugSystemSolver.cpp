@@ -0,0 +1,712 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpBlockSchurAugSystemSolver.hpp"
+#include "IpTripletHelper.hpp"
+#include "IpLapack.hpp"
+#include "IpBlas.hpp"
+
+#include <set>
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  BlockSchurAugSystemSolver::BlockSchurAugSystemSolver(SymLinearSolver& linSolver)
+      :
+      AugSystemSolver(),
+      linsolver_(&linSolver),
+      n_x_(-1),
+      n_s_(-1),
+      n_c_(-1),
+      n_d_(-1),
+      nnz_aug_(0),
+      nnz_w_(0),
+      nnz_jac_c_(0),
+      nnz_jac_d_(0),
+      n_blocks_(0),
+      n_border_(0),
+      nnz_b_(0),
+      factorized_(false),
+      num_neg_evals_(-1),
+      w_tag_(0),
+      w_factor_(0.),
+      d_x_tag_(0),
+      delta_x_(0.),
+      d_s_tag_(0),
+      delta_s_(0.),
+      j_c_tag_(0),
+      d_c_tag_(0),
+      delta_c_(0.),
+      j_d_tag_(0),
+      d_d_tag_(0),
+      delta_d_(0.)
+  {
+    DBG_START_METH("BlockSchurAugSystemSolver::BlockSchurAugSystemSolver()",
+                   dbg_verbosity);
+    DBG_ASSERT(IsValid(linsolver_));
+  }
+
+  BlockSchurAugSystemSolver::~BlockSchurAugSystemSolver()
+  {
+    DBG_START_METH("BlockSchurAugSystemSolver::~BlockSchurAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  void BlockSchurAugSystemSolver::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddStringOption1(
+      "block_schur_metadata_tag",
+      "Name of the integer variable meta data that defines the blocks.",
+      "block",
+      "*", "Any name of integer meta data",
+      "This is only used if \"aug_system_solver\" is set to "
+      "\"block-schur\".  The meta data with this name (see "
+      "get_var_con_metadata) assigns each variable to a block; the value 0 "
+      "marks the coupling variables.");
+  }
+
+  bool BlockSchurAugSystemSolver::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetStringValue("block_schur_metadata_tag", block_metadata_tag_,
+                           prefix);
+
+    // This option is registered by OrigIpoptNLP
+    bool warm_start_same_structure;
+    options.GetBoolValue("warm_start_same_structure",
+                         warm_start_same_structure, prefix);
+    if (!warm_start_same_structure) {
+      // Discard the block structure, so that it is analyzed again for
+      // the next matrix
+      n_x_ = -1;
+      n_s_ = -1;
+      n_c_ = -1;
+      n_d_ = -1;
+      n_blocks_ = 0;
+      n_border_ = 0;
+      nnz_b_ = 0;
+      aug_dest_.clear();
+      aug_pos_.clear();
+      b_row_.clear();
+      b_col_.clear();
+      c_row_.clear();
+      c_col_.clear();
+      block_vec_space_ = NULL;
+      block_matrix_space_ = NULL;
+      block_matrix_ = NULL;
+      old_w_ = NULL;
+    }
+    else {
+      ASSERT_EXCEPTION(n_x_ >= 0, INVALID_WARMSTART,
+                       "BlockSchurAugSystemSolver called with warm_start_same_structure, but the block structure has not been analyzed.");
+    }
+
+    // Force a new factorization, since the linear solver might be
+    // reinitialized
+    factorized_ = false;
+
+    return linsolver_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
+                                  options, prefix);
+  }
+
+  ESymSolverStatus BlockSchurAugSystemSolver::MultiSolve(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix* J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix* J_d,
+    const Vector* D_d,
+    double delta_d,
+    std::vector<SmartPtr<const Vector> >& rhs_xV,
+    std::vector<SmartPtr<const Vector> >& rhs_sV,
+    std::vector<SmartPtr<const Vector> >& rhs_cV,
+    std::vector<SmartPtr<const Vector> >& rhs_dV,
+    std::vector<SmartPtr<Vector> >& sol_xV,
+    std::vector<SmartPtr<Vector> >& sol_sV,
+    std::vector<SmartPtr<Vector> >& sol_cV,
+    std::vector<SmartPtr<Vector> >& sol_dV,
+    bool check_NegEVals,
+    Index numberOfNegEVals)
+  {
+    DBG_START_METH("BlockSchurAugSystemSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(J_c && J_d && "Currently, you MUST specify J_c and J_d in the augmented system");
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().Start();
+
+    Index nrhs = (Index)rhs_xV.size();
+    DBG_ASSERT(nrhs>0);
+
+    if (n_x_ < 0) {
+      DBG_ASSERT(W && "W must be given during the first call to set up the structure");
+      AnalyzeStructure(*W, *J_c, *J_d, *rhs_xV[0]);
+    }
+
+    bool new_matrix = !factorized_ ||
+                      AugmentedSystemRequiresChange(W, W_factor, D_x, delta_x,
+                          D_s, delta_s, *J_c, D_c, delta_c,
+                          *J_d, D_d, delta_d);
+    if (new_matrix) {
+      FillValues(W, W_factor, D_x, delta_x, D_s, delta_s, *J_c, D_c, delta_c,
+                 *J_d, D_d, delta_d);
+      factorized_ = false;
+    }
+
+    const Index n_aug = n_x_ + n_s_ + n_c_ + n_d_;
+    const Index off_s = n_x_;
+    const Index off_c = off_s + n_s_;
+    const Index off_d = off_c + n_c_;
+
+    // Collect the right hand sides and split them into the parts for
+    // the blocks and for the border
+    std::vector<Number> rhs_aug(n_aug);
+    std::vector<Number> rhs_border(n_border_*nrhs);
+    std::vector<SmartPtr<DenseVector> > block_rhs;
+    if (n_blocks_ > 0) {
+      if (new_matrix) {
+        // The columns of the border part B are solved for
+        // together with the actual right hand sides
+        for (Index p=0; p<n_border_; p++) {
+          block_rhs.push_back(block_vec_space_->MakeNewDenseVector());
+          block_rhs[p]->Set(0.);
+        }
+        for (Index e=0; e<nnz_b_; e++) {
+          block_rhs[b_col_[e]]->Values()[b_row_[e]] += border_vals_[e];
+        }
+      }
+      for (Index i=0; i<nrhs; i++) {
+        block_rhs.push_back(block_vec_space_->MakeNewDenseVector());
+      }
+    }
+    const Index first_rhs = (Index)block_rhs.size() - nrhs;
+    for (Index i=0; i<nrhs; i++) {
+      TripletHelper::FillValuesFromVector(n_x_, *rhs_xV[i], &rhs_aug[0]);
+      TripletHelper::FillValuesFromVector(n_s_, *rhs_sV[i], &rhs_aug[0] + off_s);
+      TripletHelper::FillValuesFromVector(n_c_, *rhs_cV[i], &rhs_aug[0] + off_c);
+      TripletHelper::FillValuesFromVector(n_d_, *rhs_dV[i], &rhs_aug[0] + off_d);
+      Number* block_vals = NULL;
+      if (n_blocks_ > 0) {
+        block_vals = block_rhs[first_rhs+i]->Values();
+      }
+      Number* border_vals = NULL;
+      if (n_border_ > 0) {
+        border_vals = &rhs_border[i*n_border_];
+      }
+      for (Index g=0; g<n_aug; g++) {
+        Index pos = aug_pos_[g];
+        if (pos >= 0) {
+          block_vals[pos] = rhs_aug[g];
+        }
+        else {
+          border_vals[-pos-1] = rhs_aug[g];
+        }
+      }
+    }
+
+    // Solve with the block matrix.  The inertia is checked below
+    // for the overall system.
+    std::vector<SmartPtr<const Vector> > block_rhsV(block_rhs.size());
+    std::vector<SmartPtr<Vector> > block_solV(block_rhs.size());
+    for (Index i=0; i<(Index)block_rhs.size(); i++) {
+      block_rhsV[i] = GetRawPtr(block_rhs[i]);
+      block_solV[i] = block_vec_space_->MakeNew();
+    }
+    ESymSolverStatus retval = SYMSOLVER_SUCCESS;
+    if (n_blocks_ > 0) {
+      retval = linsolver_->MultiSolve(*block_matrix_, block_rhsV, block_solV,
+                                      false, 0);
+      if (retval != SYMSOLVER_SUCCESS) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Factorization of the blocks failed with retval = %d\n",
+                       retval);
+        factorized_ = false;
+        IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+        return retval;
+      }
+    }
+
+    if (new_matrix) {
+      Index neg_evals = 0;
+      if (n_blocks_ > 0 && linsolver_->ProvidesInertia()) {
+        neg_evals = linsolver_->NumberOfNegEVals();
+      }
+
+      if (n_border_ > 0) {
+        // Compute S = C - B^T A^{-1} B in the lower triangle of schur_
+        for (Index p=0; p<n_border_; p++) {
+          if (n_blocks_ > 0) {
+            const Number* vals =
+              static_cast<const DenseVector*>(GetRawPtr(block_solV[p]))->Values();
+            IpBlasDcopy(n_blocks_, vals, 1, &inv_a_b_[0] + p*n_blocks_, 1);
+          }
+        }
+        const Number zero = 0.;
+        IpBlasDcopy(n_border_*n_border_, &zero, 0, &schur_[0], 1);
+        for (Index e=0; e<(Index)c_row_.size(); e++) {
+          schur_[c_row_[e] + c_col_[e]*n_border_] += border_vals_[nnz_b_+e];
+        }
+        for (Index e=0; e<nnz_b_; e++) {
+          const Index row = b_col_[e];
+          const Number val = border_vals_[e];
+          for (Index col=0; col<=row; col++) {
+            schur_[row + col*n_border_] -= val*inv_a_b_[b_row_[e] + col*n_blocks_];
+          }
+        }
+
+        Index schur_neg_evals;
+        Index info;
+        IpLapackDsytrf(n_border_, &schur_[0], n_border_, &schur_ipiv_[0],
+                       schur_neg_evals, info);
+        if (info != 0) {
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "Schur complement of the border is singular (info = %d).\n",
+                         info);
+          IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+          return SYMSOLVER_SINGULAR;
+        }
+        neg_evals += schur_neg_evals;
+      }
+      num_neg_evals_ = neg_evals;
+      factorized_ = true;
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Factorization successful, number of negative eigenvalues = %d\n",
+                     num_neg_evals_);
+    }
+
+    if (check_NegEVals && ProvidesInertia() &&
+        num_neg_evals_ != numberOfNegEVals) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Wrong inertia: required are %d, but we got %d.\n",
+                     numberOfNegEVals, num_neg_evals_);
+      IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+
+    // Obtain the solutions:  The border part solves
+    // S x_B = r_B - B^T A^{-1} r_A, and then x_A = A^{-1} r_A - A^{-1} B x_B
+    std::vector<Number> sol_aug(n_aug);
+    for (Index i=0; i<nrhs; i++) {
+      Number* block_vals = NULL;
+      if (n_blocks_ > 0) {
+        block_vals = static_cast<DenseVector*>(GetRawPtr(block_solV[first_rhs+i]))->Values();
+      }
+      if (n_border_ > 0) {
+        Number* border_vals = &rhs_border[i*n_border_];
+        for (Index e=0; e<nnz_b_; e++) {
+          border_vals[b_col_[e]] -= border_vals_[e]*block_vals[b_row_[e]];
+        }
+        IpLapackDsytrs(n_border_, 1, &schur_[0], n_border_, &schur_ipiv_[0],
+                       border_vals, n_border_);
+        if (n_blocks_ > 0) {
+          // Note that IpBlasDgemv expects the dimensions of the
+          // transposed (row-major) matrix
+          IpBlasDgemv(false, n_border_, n_blocks_, -1., &inv_a_b_[0],
+                      n_blocks_, border_vals, 1, 1., block_vals, 1);
+        }
+      }
+      for (Index g=0; g<n_aug; g++) {
+        Index pos = aug_pos_[g];
+        if (pos >= 0) {
+          sol_aug[g] = block_vals[pos];
+        }
+        else {
+          sol_aug[g] = rhs_border[i*n_border_ - pos - 1];
+        }
+      }
+      TripletHelper::PutValuesInVector(n_x_, &sol_aug[0], *sol_xV[i]);
+      TripletHelper::PutValuesInVector(n_s_, &sol_aug[0] + off_s, *sol_sV[i]);
+      TripletHelper::PutValuesInVector(n_c_, &sol_aug[0] + off_c, *sol_cV[i]);
+      TripletHelper::PutValuesInVector(n_d_, &sol_aug[0] + off_d, *sol_dV[i]);
+    }
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+    return SYMSOLVER_SUCCESS;
+  }
+
+  void BlockSchurAugSystemSolver::AnalyzeStructure(const SymMatrix& W,
+      const Matrix& J_c,
+      const Matrix& J_d,
+      const Vector& proto_x)
+  {
+    DBG_START_METH("BlockSchurAugSystemSolver::AnalyzeStructure",
+                   dbg_verbosity);
+
+    n_x_ = J_c.NCols();
+    n_c_ = J_c.NRows();
+    n_d_ = J_d.NRows();
+    n_s_ = n_d_;
+    const Index n_aug = n_x_ + n_s_ + n_c_ + n_d_;
+    const Index off_s = n_x_;
+    const Index off_c = off_s + n_s_;
+    const Index off_d = off_c + n_c_;
+
+    old_w_ = &W;
+    nnz_w_ = TripletHelper::GetNumberEntries(W);
+    nnz_jac_c_ = TripletHelper::GetNumberEntries(J_c);
+    nnz_jac_d_ = TripletHelper::GetNumberEntries(J_d);
+    nnz_aug_ = nnz_w_ + n_x_ + n_s_ + nnz_jac_c_ + n_c_ + nnz_jac_d_ + 2*n_d_;
+
+    // Get the structure of the augmented system (with 1-based indices)
+    std::vector<Index> irow(nnz_aug_+1);
+    std::vector<Index> jcol(nnz_aug_+1);
+    Index pos = 0;
+    TripletHelper::FillRowCol(nnz_w_, W, &irow[pos], &jcol[pos]);
+    pos += nnz_w_;
+    for (Index i=0; i<n_x_; i++) {
+      irow[pos] = jcol[pos] = i + 1;
+      pos++;
+    }
+    for (Index i=0; i<n_s_; i++) {
+      irow[pos] = jcol[pos] = off_s + i + 1;
+      pos++;
+    }
+    TripletHelper::FillRowCol(nnz_jac_c_, J_c, &irow[pos], &jcol[pos], off_c, 0);
+    pos += nnz_jac_c_;
+    for (Index i=0; i<n_c_; i++) {
+      irow[pos] = jcol[pos] = off_c + i + 1;
+      pos++;
+    }
+    TripletHelper::FillRowCol(nnz_jac_d_, J_d, &irow[pos], &jcol[pos], off_d, 0);
+    pos += nnz_jac_d_;
+    for (Index i=0; i<n_d_; i++) {
+      irow[pos] = off_d + i + 1;
+      jcol[pos] = off_s + i + 1;
+      pos++;
+    }
+    for (Index i=0; i<n_d_; i++) {
+      irow[pos] = jcol[pos] = off_d + i + 1;
+      pos++;
+    }
+    DBG_ASSERT(pos == nnz_aug_);
+
+    // Block numbers of the variables from the meta data
+    std::vector<Index> block(n_aug, 1);
+    const DenseVectorSpace* x_space =
+      dynamic_cast<const DenseVectorSpace*>(GetRawPtr(proto_x.OwnerSpace()));
+    if (x_space && x_space->HasIntegerMetaData(block_metadata_tag_)) {
+      const std::vector<Index>& md =
+        x_space->GetIntegerMetaData(block_metadata_tag_);
+      ASSERT_EXCEPTION((Index)md.size() == n_x_, OPTION_INVALID,
+                       "Meta data for the blocks has the wrong size.");
+      for (Index i=0; i<n_x_; i++) {
+        block[i] = Max(md[i], 0);
+      }
+    }
+    else {
+      Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
+                     "WARNING: No variable meta data \"%s\" given, the augmented system is treated as a single block.\n",
+                     block_metadata_tag_.c_str());
+    }
+
+    // Variables of different blocks that are coupled through the
+    // Hessian cannot be kept in their blocks
+    Index n_moved = 0;
+    for (Index e=0; e<nnz_w_; e++) {
+      Index i = irow[e] - 1;
+      Index j = jcol[e] - 1;
+      if (block[i] > 0 && block[j] > 0 && block[i] != block[j]) {
+        block[j] = 0;
+        n_moved++;
+      }
+    }
+
+    // Assign the constraints to the blocks of their variables.  A
+    // value of -1 means that no block variable has been found yet.
+    for (Index i=n_x_; i<n_aug; i++) {
+      block[i] = -1;
+    }
+    Index e_first = nnz_w_ + n_x_ + n_s_;
+    Index e_last = e_first + nnz_jac_c_;
+    for (Index k=0; k<2; k++) {
+      for (Index e=e_first; e<e_last; e++) {
+        Index r = irow[e] - 1;
+        Index b = block[jcol[e] - 1];
+        if (b > 0) {
+          if (block[r] < 0) {
+            block[r] = b;
+          }
+          else if (block[r] != b) {
+            block[r] = 0;
+          }
+        }
+      }
+      e_first = e_last + n_c_;
+      e_last = e_first + nnz_jac_d_;
+    }
+    for (Index i=n_x_; i<n_aug; i++) {
+      if (block[i] < 0) {
+        block[i] = 0;
+      }
+    }
+    // The slacks belong to the block of their constraint
+    for (Index i=0; i<n_s_; i++) {
+      block[off_s + i] = block[off_d + i];
+    }
+
+    // Positions of the unknowns in the blocks and the border
+    aug_pos_.resize(n_aug);
+    n_blocks_ = 0;
+    n_border_ = 0;
+    std::set<Index> block_numbers;
+    for (Index g=0; g<n_aug; g++) {
+      if (block[g] > 0) {
+        aug_pos_[g] = n_blocks_++;
+        block_numbers.insert(block[g]);
+      }
+      else {
+        aug_pos_[g] = -(n_border_++) - 1;
+      }
+    }
+
+    // Destinations of the elements
+    aug_dest_.resize(nnz_aug_);
+    std::vector<Index> a_irow;
+    std::vector<Index> a_jcol;
+    b_row_.clear();
+    b_col_.clear();
+    c_row_.clear();
+    c_col_.clear();
+    std::vector<Index> c_elems;
+    for (Index e=0; e<nnz_aug_; e++) {
+      Index pr = aug_pos_[irow[e] - 1];
+      Index pc = aug_pos_[jcol[e] - 1];
+      if (pr >= 0 && pc >= 0) {
+        DBG_ASSERT(block[irow[e]-1] == block[jcol[e]-1]);
+        aug_dest_[e] = (Index)a_irow.size();
+        a_irow.push_back(pr + 1);
+        a_jcol.push_back(pc + 1);
+      }
+      else if (pr >= 0) {
+        aug_dest_[e] = -(Index)b_row_.size() - 1;
+        b_row_.push_back(pr);
+        b_col_.push_back(-pc - 1);
+      }
+      else if (pc >= 0) {
+        aug_dest_[e] = -(Index)b_row_.size() - 1;
+        b_row_.push_back(pc);
+        b_col_.push_back(-pr - 1);
+      }
+      else {
+        c_elems.push_back(e);
+        c_row_.push_back(Max(-pr - 1, -pc - 1));
+        c_col_.push_back(Min(-pr - 1, -pc - 1));
+      }
+    }
+    nnz_b_ = (Index)b_row_.size();
+    for (Index k=0; k<(Index)c_elems.size(); k++) {
+      aug_dest_[c_elems[k]] = -(nnz_b_ + k) - 1;
+    }
+
+    if (n_blocks_ > 0) {
+      block_vec_space_ = new DenseVectorSpace(n_blocks_);
+      block_matrix_space_ = new SymTMatrixSpace(n_blocks_, (Index)a_irow.size(),
+                            &a_irow[0], &a_jcol[0]);
+      block_matrix_ = block_matrix_space_->MakeNewSymTMatrix();
+    }
+    border_vals_.resize(nnz_b_ + c_elems.size());
+    inv_a_b_.resize(n_blocks_*n_border_);
+    schur_.resize(n_border_*n_border_);
+    schur_ipiv_.resize(n_border_);
+    aug_vals_.resize(nnz_aug_+1);
+
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Augmented system has %d unknowns in %d blocks and %d unknowns in the border.\n",
+                   n_blocks_, (Index)block_numbers.size(), n_border_);
+    if (n_moved > 0) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "%d variables have been moved to the border since they are coupled\nwith other blocks through the Hessian.\n",
+                     n_moved);
+    }
+  }
+
+  void BlockSchurAugSystemSolver::FillValues(const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix& J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix& J_d,
+      const Vector* D_d,
+      double delta_d)
+  {
+    DBG_START_METH("BlockSchurAugSystemSolver::FillValues", dbg_verbosity);
+
+    Number* vals = &aug_vals_[0];
+    if (W && W_factor != 0.) {
+      DBG_ASSERT(TripletHelper::GetNumberEntries(*W) == nnz_w_);
+      TripletHelper::FillValues(nnz_w_, *W, vals);
+      if (W_factor != 1.) {
+        IpBlasDscal(nnz_w_, W_factor, vals, 1);
+      }
+      old_w_ = W;
+    }
+    else {
+      const Number zero = 0.;
+      IpBlasDcopy(nnz_w_, &zero, 0, vals, 1);
+    }
+    vals += nnz_w_;
+
+    if (D_x) {
+      TripletHelper::FillValuesFromVector(n_x_, *D_x, vals);
+    }
+    else {
+      const Number zero = 0.;
+      IpBlasDcopy(n_x_, &zero, 0, vals, 1);
+    }
+    for (Index i=0; i<n_x_; i++) {
+      vals[i] += delta_x;
+    }
+    vals += n_x_;
+
+    if (D_s) {
+      TripletHelper::FillValuesFromVector(n_s_, *D_s, vals);
+    }
+    else {
+      const Number zero = 0.;
+      IpBlasDcopy(n_s_, &zero, 0, vals, 1);
+    }
+    for (Index i=0; i<n_s_; i++) {
+      vals[i] += delta_s;
+    }
+    vals += n_s_;
+
+    TripletHelper::FillValues(nnz_jac_c_, J_c, vals);
+    vals += nnz_jac_c_;
+
+    if (D_c) {
+      TripletHelper::FillValuesFromVector(n_c_, *D_c, vals);
+    }
+    else {
+      const Number zero = 0.;
+      IpBlasDcopy(n_c_, &zero, 0, vals, 1);
+    }
+    for (Index i=0; i<n_c_; i++) {
+      vals[i] -= delta_c;
+    }
+    vals += n_c_;
+
+    TripletHelper::FillValues(nnz_jac_d_, J_d, vals);
+    vals += nnz_jac_d_;
+
+    for (Index i=0; i<n_d_; i++) {
+      vals[i] = -1.;
+    }
+    vals += n_d_;
+
+    if (D_d) {
+      TripletHelper::FillValuesFromVector(n_d_, *D_d, vals);
+    }
+    else {
+      const Number zero = 0.;
+      IpBlasDcopy(n_d_, &zero, 0, vals, 1);
+    }
+    for (Index i=0; i<n_d_; i++) {
+      vals[i] -= delta_d;
+    }
+
+    // Distribute the values
+    Number* block_vals = NULL;
+    if (n_blocks_ > 0) {
+      block_vals = block_matrix_->Values();
+    }
+    for (Index e=0; e<nnz_aug_; e++) {
+      Index dest = aug_dest_[e];
+      if (dest >= 0) {
+        block_vals[dest] = aug_vals_[e];
+      }
+      else {
+        border_vals_[-dest-1] = aug_vals_[e];
+      }
+    }
+
+    // Remember the tags and values of this system
+    if (W) {
+      w_tag_ = W->GetTag();
+    }
+    else {
+      w_tag_ = 0;
+    }
+    w_factor_ = W_factor;
+    d_x_tag_ = D_x ? D_x->GetTag() : 0;
+    delta_x_ = delta_x;
+    d_s_tag_ = D_s ? D_s->GetTag() : 0;
+    delta_s_ = delta_s;
+    j_c_tag_ = J_c.GetTag();
+    d_c_tag_ = D_c ? D_c->GetTag() : 0;
+    delta_c_ = delta_c;
+    j_d_tag_ = J_d.GetTag();
+    d_d_tag_ = D_d ? D_d->GetTag() : 0;
+    delta_d_ = delta_d;
+  }
+
+  bool BlockSchurAugSystemSolver::AugmentedSystemRequiresChange(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix& J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix& J_d,
+    const Vector* D_d,
+    double delta_d)
+  {
+    if ( (W && W->GetTag() != w_tag_)
+         || (!W && w_tag_ != 0)
+         || (W_factor != w_factor_)
+         || (D_x && D_x->GetTag() != d_x_tag_)
+         || (!D_x && d_x_tag_ != 0)
+         || (delta_x != delta_x_)
+         || (D_s && D_s->GetTag() != d_s_tag_)
+         || (!D_s && d_s_tag_ != 0)
+         || (delta_s != delta_s_)
+         || (J_c.GetTag() != j_c_tag_)
+         || (D_c && D_c->GetTag() != d_c_tag_)
+         || (!D_c && d_c_tag_ != 0)
+         || (delta_c != delta_c_)
+         || (J_d.GetTag() != j_d_tag_)
+         || (D_d && D_d->GetTag() != d_d_tag_)
+         || (!D_d && d_d_tag_ != 0)
+         || (delta_d != delta_d_) ) {
+      return true;
+    }
+
+    return false;
+  }
+
+  Index BlockSchurAugSystemSolver::NumberOfNegEVals() const
+  {
+    DBG_ASSERT(factorized_);
+    return num_neg_evals_;
+  }
+
+  bool BlockSchurAugSystemSolver::ProvidesInertia() const
+  {
+    return linsolver_->ProvidesInertia();
+  }
+
+  bool BlockSchurAugSystemSolver::IncreaseQuality()
+  {
+    // The Schur complement has to be recomputed with the new
+    // factorization of the blocks
+    factorized_ = false;
+    return linsolver_->IncreaseQuality();
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,282 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IP_BLOCKSCHURAUGSYSTEMSOLVER_HPP__
+#define __IP_BLOCKSCHURAUGSYSTEMSOLVER_HPP__
+
+#include "IpAugSystemSolver.hpp"
+#include "IpSymLinearSolver.hpp"
+#include "IpSymTMatrix.hpp"
+#include "IpDenseVector.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** Solver for the augmented system of problems with block-bordered
+   *  structure, such as multi-scenario (stochastic) or multi-period
+   *  problems.
+   *
+   *  The user assigns the variables to blocks through the integer
+   *  meta data "block" of the variables (see
+   *  TNLP::get_var_con_metadata; the name can be changed with the
+   *  option block_schur_metadata_tag).  A value of 0 marks the coupling
+   *  (border) variables, and positive values denote the independent
+   *  blocks.  The constraints are assigned automatically: A
+   *  constraint that involves non-coupling variables of only one
+   *  block belongs to that block (together with its slack), all
+   *  other constraints are coupling constraints.  If the Hessian
+   *  links variables of two different blocks, one of them is moved
+   *  to the border.
+   *
+   *  With the unknowns reordered into the blocks (A) and the border
+   *  (C), the augmented system reads
+   *
+   *  \f$\left[\begin{array}{cc} A & B\\ B^T & C\end{array}\right]\f$,
+   *
+   *  where A is block diagonal.  A is factorized by the given sparse
+   *  linear solver, which can exploit the independence of the
+   *  blocks.  The dense Schur complement \f$S = C - B^TA^{-1}B\f$ of
+   *  the border is formed from solves with the columns of B and
+   *  factorized with the LAPACK routine DSYTRF.  The inertia of the
+   *  augmented system is the sum of the inertias of A and S.
+   *
+   *  If no block meta data is given, all unknowns are put into a
+   *  single block, and the solver behaves like the
+   *  StdAugSystemSolver.
+   */
+  class BlockSchurAugSystemSolver : public AugSystemSolver
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Constructor using the linear solver object for the blocks */
+    BlockSchurAugSystemSolver(SymLinearSolver& LinSolver);
+
+    /** Default destructor */
+    virtual ~BlockSchurAugSystemSolver();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** Set up the augmented system and solve it for a set of given
+     *  right hand sides. */
+    virtual ESymSolverStatus MultiSolve(
+      const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix* J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix* J_d,
+      const Vector* D_d,
+      double delta_d,
+      std::vector<SmartPtr<const Vector> >& rhs_xV,
+      std::vector<SmartPtr<const Vector> >& rhs_sV,
+      std::vector<SmartPtr<const Vector> >& rhs_cV,
+      std::vector<SmartPtr<const Vector> >& rhs_dV,
+      std::vector<SmartPtr<Vector> >& sol_xV,
+      std::vector<SmartPtr<Vector> >& sol_sV,
+      std::vector<SmartPtr<Vector> >& sol_cV,
+      std::vector<SmartPtr<Vector> >& sol_dV,
+      bool check_NegEVals,
+      Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last
+     *  solve.  This is the sum of the numbers of negative eigenvalues
+     *  of the block matrix and the Schur complement. */
+    virtual Index NumberOfNegEVals() const;
+
+    /** Query whether inertia is computed by linear solver.
+     *  Returns true, if linear solver provides inertia.
+     */
+    virtual bool ProvidesInertia() const;
+
+    /** Request to increase quality of solution for next solve.  This
+     *  is passed on to the linear solver for the blocks. */
+    virtual bool IncreaseQuality();
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default constructor. */
+    BlockSchurAugSystemSolver();
+    /** Copy Constructor */
+    BlockSchurAugSystemSolver(const BlockSchurAugSystemSolver&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const BlockSchurAugSystemSolver&);
+    //@}
+
+    /** Determine the block structure from the meta data and the
+     *  sparsity structure of the matrices.  This is done during the
+     *  first call of MultiSolve; it is assumed that the structure
+     *  does not change afterwards. */
+    void AnalyzeStructure(const SymMatrix& W,
+                          const Matrix& J_c,
+                          const Matrix& J_d,
+                          const Vector& proto_x);
+
+    /** Compute the values of all elements of the augmented system
+     *  (in the order given by the structure computed in
+     *  AnalyzeStructure) and distribute them into the block matrix,
+     *  the border columns and the border matrix. */
+    void FillValues(const SymMatrix* W,
+                    double W_factor,
+                    const Vector* D_x,
+                    double delta_x,
+                    const Vector* D_s,
+                    double delta_s,
+                    const Matrix& J_c,
+                    const Vector* D_c,
+                    double delta_c,
+                    const Matrix& J_d,
+                    const Vector* D_d,
+                    double delta_d);
+
+    /** Check the internal tags and decide if the passed variables are
+     *  different from what has been factorized most recently. */
+    bool AugmentedSystemRequiresChange(const SymMatrix* W,
+                                       double W_factor,
+                                       const Vector* D_x,
+                                       double delta_x,
+                                       const Vector* D_s,
+                                       double delta_s,
+                                       const Matrix& J_c,
+                                       const Vector* D_c,
+                                       double delta_c,
+                                       const Matrix& J_d,
+                                       const Vector* D_d,
+                                       double delta_d);
+
+    /** The linear solver object for the (block diagonal) matrix of
+     *  the blocks. */
+    SmartPtr<SymLinearSolver> linsolver_;
+
+    /** @name Structure of the augmented system */
+    //@{
+    /** Dimensions of the parts of the augmented system */
+    Index n_x_;
+    Index n_s_;
+    Index n_c_;
+    Index n_d_;
+    /** Number of elements of the augmented system.  The elements are
+     *  ordered as follows: Hessian W, diagonal for x, diagonal for s,
+     *  Jacobian J_c, diagonal for c, Jacobian J_d, identity between
+     *  d and s, diagonal for d. */
+    Index nnz_aug_;
+    /** Number of elements of W */
+    Index nnz_w_;
+    /** Number of elements of J_c */
+    Index nnz_jac_c_;
+    /** Number of elements of J_d */
+    Index nnz_jac_d_;
+    /** Number of unknowns in the blocks */
+    Index n_blocks_;
+    /** Number of unknowns in the border */
+    Index n_border_;
+    /** For each element of the augmented system, the position where
+     *  its value is stored: if nonnegative, in the values of
+     *  block_matrix_; if negative, -(p+1) is the position in
+     *  border_vals_ (which contains first the elements of B and then
+     *  those of C). */
+    std::vector<Index> aug_dest_;
+    /** For each unknown of the augmented system, the position within
+     *  the blocks (if nonnegative), or -(p+1) with the position p
+     *  within the border. */
+    std::vector<Index> aug_pos_;
+    /** Number of elements in B */
+    Index nnz_b_;
+    /** Row (position in the blocks) of the elements of B */
+    std::vector<Index> b_row_;
+    /** Column (position in the border) of the elements of B */
+    std::vector<Index> b_col_;
+    /** Row and column (position in the border) of the elements of
+     *  C, with row >= col */
+    std::vector<Index> c_row_;
+    std::vector<Index> c_col_;
+    //@}
+
+    /** @name Numerical values */
+    //@{
+    /** Space for vectors in the blocks */
+    SmartPtr<DenseVectorSpace> block_vec_space_;
+    /** Space for the matrix of the blocks */
+    SmartPtr<SymTMatrixSpace> block_matrix_space_;
+    /** Matrix of the blocks */
+    SmartPtr<SymTMatrix> block_matrix_;
+    /** Values of the elements of B and C */
+    std::vector<Number> border_vals_;
+    /** Solutions of the block system for the columns of B, stored
+     *  as a dense column-major matrix of dimension n_blocks_ times
+     *  n_border_ */
+    std::vector<Number> inv_a_b_;
+    /** Factor of the Schur complement computed by DSYTRF */
+    std::vector<Number> schur_;
+    /** Pivot information from DSYTRF */
+    std::vector<Index> schur_ipiv_;
+    /** Work space for the values of the full augmented system */
+    std::vector<Number> aug_vals_;
+    /** Flag indicating whether the current values have been
+     *  factorized successfully */
+    bool factorized_;
+    /** Number of negative eigenvalues of the most recent
+     *  factorization */
+    Index num_neg_evals_;
+    //@}
+
+    /**@name Tags and values to track in order to decide whether the
+       matrix has to be updated compared to the most recent call of
+       the Set method.
+     */
+    //@{
+    TaggedObject::Tag w_tag_;
+    double w_factor_;
+    TaggedObject::Tag d_x_tag_;
+    double delta_x_;
+    TaggedObject::Tag d_s_tag_;
+    double delta_s_;
+    TaggedObject::Tag j_c_tag_;
+    TaggedObject::Tag d_c_tag_;
+    double delta_c_;
+    TaggedObject::Tag j_d_tag_;
+    TaggedObject::Tag d_d_tag_;
+    double delta_d_;
+    //@}
+
+    /** A previous W used to determine the structure.  Since
+     *  MultiSolve can be called with a NULL W, we keep the last W
+     *  to fill the corresponding elements. */
+    SmartPtr<const SymMatrix> old_w_;
+
+    /** @name Algorithmic parameters */
+    //@{
+    /** Name of the integer meta data with the block numbers of the
+     *  variables */
+    std::string block_metadata_tag_;
+    //@}
+  };
+
+} // namespace Ipopt
+
+#endif
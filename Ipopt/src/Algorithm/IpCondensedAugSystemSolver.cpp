@@ -0,0 +1,455 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpCondensedAugSystemSolver.hpp"
+#include "IpTripletHelper.hpp"
+#include "IpLapack.hpp"
+#include "IpBlas.hpp"
+
+#include <algorithm>
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  CondensedAugSystemSolver::CondensedAugSystemSolver()
+      :
+      AugSystemSolver(),
+      structure_analyzed_(false),
+      n_x_(0),
+      n_c_(0),
+      n_d_(0),
+      n_red_(0),
+      nnz_w_(0),
+      nnz_jac_c_(0),
+      nnz_jac_d_(0),
+      factorized_(false),
+      num_neg_evals_(-1),
+      w_tag_(0),
+      w_factor_(0.),
+      d_x_tag_(0),
+      delta_x_(0.),
+      d_s_tag_(0),
+      delta_s_(0.),
+      j_c_tag_(0),
+      d_c_tag_(0),
+      delta_c_(0.),
+      j_d_tag_(0),
+      d_d_tag_(0),
+      delta_d_(0.)
+  {
+    DBG_START_METH("CondensedAugSystemSolver::CondensedAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  CondensedAugSystemSolver::~CondensedAugSystemSolver()
+  {
+    DBG_START_METH("CondensedAugSystemSolver::~CondensedAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  bool CondensedAugSystemSolver::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    // This option is registered by OrigIpoptNLP
+    bool warm_start_same_structure;
+    options.GetBoolValue("warm_start_same_structure",
+                         warm_start_same_structure, prefix);
+    if (!warm_start_same_structure) {
+      structure_analyzed_ = false;
+      n_red_ = 0;
+      dense_pos_.clear();
+      jd_row_.clear();
+      jd_col_.clear();
+      jd_order_.clear();
+      jd_row_start_.clear();
+    }
+    else {
+      ASSERT_EXCEPTION(structure_analyzed_, INVALID_WARMSTART,
+                       "CondensedAugSystemSolver called with warm_start_same_structure, but the structure of the augmented system has not been analyzed.");
+    }
+
+    factorized_ = false;
+    return true;
+  }
+
+  ESymSolverStatus CondensedAugSystemSolver::MultiSolve(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix* J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix* J_d,
+    const Vector* D_d,
+    double delta_d,
+    std::vector<SmartPtr<const Vector> >& rhs_xV,
+    std::vector<SmartPtr<const Vector> >& rhs_sV,
+    std::vector<SmartPtr<const Vector> >& rhs_cV,
+    std::vector<SmartPtr<const Vector> >& rhs_dV,
+    std::vector<SmartPtr<Vector> >& sol_xV,
+    std::vector<SmartPtr<Vector> >& sol_sV,
+    std::vector<SmartPtr<Vector> >& sol_cV,
+    std::vector<SmartPtr<Vector> >& sol_dV,
+    bool check_NegEVals,
+    Index numberOfNegEVals)
+  {
+    DBG_START_METH("CondensedAugSystemSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(J_c && J_d && "Currently, you MUST specify J_c and J_d in the augmented system");
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().Start();
+
+    if (!structure_analyzed_) {
+      DBG_ASSERT(W && "W must be given during the first call to set up the structure");
+      AnalyzeStructure(*W, *J_c, *J_d);
+      structure_analyzed_ = true;
+    }
+
+    if (!factorized_ ||
+        AugmentedSystemRequiresChange(W, W_factor, D_x, delta_x, D_s, delta_s,
+                                      *J_c, D_c, delta_c, *J_d, D_d, delta_d)) {
+      ESymSolverStatus retval =
+        Factorize(W, W_factor, D_x, delta_x, D_s, delta_s, *J_c, D_c, delta_c,
+                  *J_d, D_d, delta_d);
+      if (retval != SYMSOLVER_SUCCESS) {
+        IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+        return retval;
+      }
+    }
+
+    if (check_NegEVals && num_neg_evals_ != numberOfNegEVals) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Wrong inertia: required are %d, but we got %d.\n",
+                     numberOfNegEVals, num_neg_evals_);
+      IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+
+    const Number* jd_vals = &vals_[0] + nnz_w_ + nnz_jac_c_;
+
+    // Condense the right hand sides: with t = r_d + (D_s + delta_s
+    // I)^{-1} r_s, the right hand side for x becomes
+    // r_x - J_d^T E^{-1} t.
+    const Index nrhs = (Index)rhs_xV.size();
+    std::vector<Number> rhs(n_red_*nrhs + 1);
+    std::vector<Number> rhs_s(n_d_*nrhs + 1);
+    std::vector<Number> t(n_d_*nrhs + 1);
+    for (Index i=0; i<nrhs; i++) {
+      Number* rhs_i = &rhs[i*n_red_];
+      Number* rhs_s_i = &rhs_s[i*n_d_];
+      Number* t_i = &t[i*n_d_];
+      TripletHelper::FillValuesFromVector(n_x_, *rhs_xV[i], rhs_i);
+      TripletHelper::FillValuesFromVector(n_c_, *rhs_cV[i], rhs_i + n_x_);
+      TripletHelper::FillValuesFromVector(n_d_, *rhs_sV[i], rhs_s_i);
+      TripletHelper::FillValuesFromVector(n_d_, *rhs_dV[i], t_i);
+      for (Index j=0; j<n_d_; j++) {
+        t_i[j] += inv_sigma_s_[j]*rhs_s_i[j];
+      }
+      for (Index e=0; e<nnz_jac_d_; e++) {
+        Index j = jd_row_[e];
+        rhs_i[jd_col_[e]] -= jd_vals[e]*inv_e_[j]*t_i[j];
+      }
+    }
+
+    IpData().TimingStats().LinearSystemBackSolve().Start();
+    IpLapackDsytrs(n_red_, nrhs, &factor_[0], n_red_, &ipiv_[0], &rhs[0],
+                   n_red_);
+    IpData().TimingStats().LinearSystemBackSolve().End();
+
+    // Recover the eliminated parts of the solution:
+    // sol_d = E^{-1} (t - J_d sol_x), and
+    // sol_s = (D_s + delta_s I)^{-1} (r_s + sol_d).
+    std::vector<Number> sol_d(n_d_ + 1);
+    for (Index i=0; i<nrhs; i++) {
+      const Number* sol_i = &rhs[i*n_red_];
+      Number* rhs_s_i = &rhs_s[i*n_d_];
+      const Number* t_i = &t[i*n_d_];
+      for (Index j=0; j<n_d_; j++) {
+        sol_d[j] = t_i[j];
+      }
+      for (Index e=0; e<nnz_jac_d_; e++) {
+        sol_d[jd_row_[e]] -= jd_vals[e]*sol_i[jd_col_[e]];
+      }
+      for (Index j=0; j<n_d_; j++) {
+        sol_d[j] *= inv_e_[j];
+        rhs_s_i[j] = inv_sigma_s_[j]*(rhs_s_i[j] + sol_d[j]);
+      }
+      TripletHelper::PutValuesInVector(n_x_, sol_i, *sol_xV[i]);
+      TripletHelper::PutValuesInVector(n_d_, rhs_s_i, *sol_sV[i]);
+      TripletHelper::PutValuesInVector(n_c_, sol_i + n_x_, *sol_cV[i]);
+      TripletHelper::PutValuesInVector(n_d_, &sol_d[0], *sol_dV[i]);
+    }
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+    return SYMSOLVER_SUCCESS;
+  }
+
+  void CondensedAugSystemSolver::AnalyzeStructure(const SymMatrix& W,
+      const Matrix& J_c,
+      const Matrix& J_d)
+  {
+    DBG_START_METH("CondensedAugSystemSolver::AnalyzeStructure",
+                   dbg_verbosity);
+
+    n_x_ = J_c.NCols();
+    n_c_ = J_c.NRows();
+    n_d_ = J_d.NRows();
+    n_red_ = n_x_ + n_c_;
+
+    nnz_w_ = TripletHelper::GetNumberEntries(W);
+    nnz_jac_c_ = TripletHelper::GetNumberEntries(J_c);
+    nnz_jac_d_ = TripletHelper::GetNumberEntries(J_d);
+    const Index nnz = nnz_w_ + nnz_jac_c_ + nnz_jac_d_;
+
+    std::vector<Index> irow(nnz+1);
+    std::vector<Index> jcol(nnz+1);
+    TripletHelper::FillRowCol(nnz_w_, W, &irow[0], &jcol[0]);
+    TripletHelper::FillRowCol(nnz_jac_c_, J_c, &irow[nnz_w_], &jcol[nnz_w_],
+                              n_x_, 0);
+    TripletHelper::FillRowCol(nnz_jac_d_, J_d, &irow[nnz_w_ + nnz_jac_c_],
+                              &jcol[nnz_w_ + nnz_jac_c_]);
+
+    dense_pos_.resize(nnz_w_ + nnz_jac_c_ + 1);
+    for (Index e=0; e<nnz_w_ + nnz_jac_c_; e++) {
+      Index r = irow[e] - 1;
+      Index c = jcol[e] - 1;
+      if (r >= c) {
+        dense_pos_[e] = r + c*n_red_;
+      }
+      else {
+        dense_pos_[e] = c + r*n_red_;
+      }
+    }
+
+    // Sort the elements of J_d by rows
+    jd_row_.resize(nnz_jac_d_ + 1);
+    jd_col_.resize(nnz_jac_d_ + 1);
+    jd_order_.resize(nnz_jac_d_ + 1);
+    jd_row_start_.assign(n_d_ + 1, 0);
+    for (Index e=0; e<nnz_jac_d_; e++) {
+      jd_row_[e] = irow[nnz_w_ + nnz_jac_c_ + e] - 1;
+      jd_col_[e] = jcol[nnz_w_ + nnz_jac_c_ + e] - 1;
+      jd_row_start_[jd_row_[e] + 1]++;
+    }
+    for (Index j=0; j<n_d_; j++) {
+      jd_row_start_[j+1] += jd_row_start_[j];
+    }
+    std::vector<Index> next(jd_row_start_.begin(), jd_row_start_.end() - 1);
+    for (Index e=0; e<nnz_jac_d_; e++) {
+      jd_order_[next[jd_row_[e]]++] = e;
+    }
+
+    factor_.resize(n_red_*n_red_ + 1);
+    ipiv_.resize(n_red_ + 1);
+    vals_.resize(nnz + 1);
+    inv_sigma_s_.resize(n_d_ + 1);
+    inv_e_.resize(n_d_ + 1);
+
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Condensed system has dimension %d (augmented system has dimension %d).\n",
+                   n_red_, n_red_ + 2*n_d_);
+  }
+
+  ESymSolverStatus CondensedAugSystemSolver::Factorize(const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix& J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix& J_d,
+      const Vector* D_d,
+      double delta_d)
+  {
+    DBG_START_METH("CondensedAugSystemSolver::Factorize", dbg_verbosity);
+
+    factorized_ = false;
+
+    // Remember the tags and values of this system
+    w_tag_ = W ? W->GetTag() : 0;
+    w_factor_ = W_factor;
+    d_x_tag_ = D_x ? D_x->GetTag() : 0;
+    delta_x_ = delta_x;
+    d_s_tag_ = D_s ? D_s->GetTag() : 0;
+    delta_s_ = delta_s;
+    j_c_tag_ = J_c.GetTag();
+    d_c_tag_ = D_c ? D_c->GetTag() : 0;
+    delta_c_ = delta_c;
+    j_d_tag_ = J_d.GetTag();
+    d_d_tag_ = D_d ? D_d->GetTag() : 0;
+    delta_d_ = delta_d;
+
+    // Eliminate the 2x2 blocks for s and d.  Each block contributes
+    // one negative eigenvalue for each of its negative pivots.
+    Index num_neg_elim = 0;
+    std::vector<Number> diag(n_d_ + 1, 0.);
+    if (D_s) {
+      TripletHelper::FillValuesFromVector(n_d_, *D_s, &diag[0]);
+    }
+    for (Index j=0; j<n_d_; j++) {
+      Number sigma_s = diag[j] + delta_s;
+      if (sigma_s == 0.) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Zero diagonal element for slack %d, cannot condense the augmented system.\n", j);
+        return SYMSOLVER_SINGULAR;
+      }
+      inv_sigma_s_[j] = 1./sigma_s;
+      if (sigma_s < 0.) {
+        num_neg_elim++;
+      }
+    }
+    std::fill(diag.begin(), diag.end(), 0.);
+    if (D_d) {
+      TripletHelper::FillValuesFromVector(n_d_, *D_d, &diag[0]);
+    }
+    for (Index j=0; j<n_d_; j++) {
+      Number e = diag[j] - delta_d - inv_sigma_s_[j];
+      if (e == 0.) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "Zero pivot for inequality constraint %d, cannot condense the augmented system.\n", j);
+        return SYMSOLVER_SINGULAR;
+      }
+      inv_e_[j] = 1./e;
+      if (e < 0.) {
+        num_neg_elim++;
+      }
+    }
+
+    // Assemble the lower triangle of the condensed system
+    const Number zero = 0.;
+    IpBlasDcopy(n_red_*n_red_, &zero, 0, &factor_[0], 1);
+
+    if (W && W_factor != 0.) {
+      DBG_ASSERT(TripletHelper::GetNumberEntries(*W) == nnz_w_);
+      TripletHelper::FillValues(nnz_w_, *W, &vals_[0]);
+      for (Index e=0; e<nnz_w_; e++) {
+        factor_[dense_pos_[e]] += W_factor*vals_[e];
+      }
+    }
+    TripletHelper::FillValues(nnz_jac_c_, J_c, &vals_[nnz_w_]);
+    for (Index e=nnz_w_; e<nnz_w_ + nnz_jac_c_; e++) {
+      factor_[dense_pos_[e]] += vals_[e];
+    }
+
+    diag.resize(n_red_ + 1);
+    std::fill(diag.begin(), diag.end(), 0.);
+    if (D_x) {
+      TripletHelper::FillValuesFromVector(n_x_, *D_x, &diag[0]);
+    }
+    if (D_c) {
+      TripletHelper::FillValuesFromVector(n_c_, *D_c, &diag[0] + n_x_);
+    }
+    for (Index i=0; i<n_x_; i++) {
+      factor_[i*(n_red_+1)] += diag[i] + delta_x;
+    }
+    for (Index i=n_x_; i<n_red_; i++) {
+      factor_[i*(n_red_+1)] += diag[i] - delta_c;
+    }
+
+    // Add -J_d^T E^{-1} J_d row by row
+    const Number* jd_vals = &vals_[0] + nnz_w_ + nnz_jac_c_;
+    TripletHelper::FillValues(nnz_jac_d_, J_d, &vals_[nnz_w_ + nnz_jac_c_]);
+    for (Index j=0; j<n_d_; j++) {
+      const Number weight = -inv_e_[j];
+      for (Index p=jd_row_start_[j]; p<jd_row_start_[j+1]; p++) {
+        const Index ep = jd_order_[p];
+        const Index cp = jd_col_[ep];
+        const Number vp = weight*jd_vals[ep];
+        for (Index q=p; q<jd_row_start_[j+1]; q++) {
+          const Index eq = jd_order_[q];
+          const Index cq = jd_col_[eq];
+          Number val = vp*jd_vals[eq];
+          if (q != p && cp == cq) {
+            // duplicate entries in the same column contribute twice
+            // to the diagonal
+            val *= 2.;
+          }
+          if (cp >= cq) {
+            factor_[cp + cq*n_red_] += val;
+          }
+          else {
+            factor_[cq + cp*n_red_] += val;
+          }
+        }
+      }
+    }
+
+    Index info;
+    Index num_neg_red;
+    IpData().TimingStats().LinearSystemFactorization().Start();
+    IpLapackDsytrf(n_red_, &factor_[0], n_red_, &ipiv_[0], num_neg_red, info);
+    IpData().TimingStats().LinearSystemFactorization().End();
+    if (info < 0) {
+      Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
+                     "Error in DSYTRF: info = %d\n", info);
+      return SYMSOLVER_FATAL_ERROR;
+    }
+    if (info > 0) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Condensed system is singular (info = %d).\n", info);
+      return SYMSOLVER_SINGULAR;
+    }
+
+    num_neg_evals_ = num_neg_red + num_neg_elim;
+    factorized_ = true;
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Factorization successful, number of negative eigenvalues = %d\n",
+                   num_neg_evals_);
+    return SYMSOLVER_SUCCESS;
+  }
+
+  bool CondensedAugSystemSolver::AugmentedSystemRequiresChange(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix& J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix& J_d,
+    const Vector* D_d,
+    double delta_d)
+  {
+    if ( (W && W->GetTag() != w_tag_)
+         || (!W && w_tag_ != 0)
+         || (W_factor != w_factor_)
+         || (D_x && D_x->GetTag() != d_x_tag_)
+         || (!D_x && d_x_tag_ != 0)
+         || (delta_x != delta_x_)
+         || (D_s && D_s->GetTag() != d_s_tag_)
+         || (!D_s && d_s_tag_ != 0)
+         || (delta_s != delta_s_)
+         || (J_c.GetTag() != j_c_tag_)
+         || (D_c && D_c->GetTag() != d_c_tag_)
+         || (!D_c && d_c_tag_ != 0)
+         || (delta_c != delta_c_)
+         || (J_d.GetTag() != j_d_tag_)
+         || (D_d && D_d->GetTag() != d_d_tag_)
+         || (!D_d && d_d_tag_ != 0)
+         || (delta_d != delta_d_) ) {
+      return true;
+    }
+
+    return false;
+  }
+
+  Index CondensedAugSystemSolver::NumberOfNegEVals() const
+  {
+    DBG_ASSERT(factorized_);
+    return num_neg_evals_;
+  }
+
+} // namespace Ipopt
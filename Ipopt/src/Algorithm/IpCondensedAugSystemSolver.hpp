@@ -0,0 +1,219 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IP_CONDENSEDAUGSYSTEMSOLVER_HPP__
+#define __IP_CONDENSEDAUGSYSTEMSOLVER_HPP__
+
+#include "IpAugSystemSolver.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** Solver for the augmented system of problems with few variables
+   *  and many inequality constraints.  The slacks s and the
+   *  multipliers of the inequality constraints d are eliminated
+   *  from the augmented system, which leaves the condensed system
+   *
+   *  \f$\left[\begin{array}{cc} W + D_x + \delta_x I - J_d^T E^{-1} J_d & J_c^T\\
+   *                         J_c & D_c - \delta_c I\end{array}\right]\f$
+   *
+   *  with the diagonal matrix \f$E = D_d - \delta_d I - (D_s +
+   *  \delta_s I)^{-1}\f$.  Its dimension is the number of variables
+   *  plus the number of equality constraints, independent of the
+   *  number of inequality constraints.  The condensed system is
+   *  formed as a dense matrix and factorized with the LAPACK routine
+   *  DSYTRF.  The inertia of the full augmented system is the
+   *  inertia of the condensed system plus the inertia of the
+   *  eliminated 2x2 blocks, so that the usual inertia correction
+   *  can be applied.
+   */
+  class CondensedAugSystemSolver : public AugSystemSolver
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Default constructor */
+    CondensedAugSystemSolver();
+
+    /** Default destructor */
+    virtual ~CondensedAugSystemSolver();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** Set up the condensed system and solve it for a set of given
+     *  right hand sides. */
+    virtual ESymSolverStatus MultiSolve(
+      const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix* J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix* J_d,
+      const Vector* D_d,
+      double delta_d,
+      std::vector<SmartPtr<const Vector> >& rhs_xV,
+      std::vector<SmartPtr<const Vector> >& rhs_sV,
+      std::vector<SmartPtr<const Vector> >& rhs_cV,
+      std::vector<SmartPtr<const Vector> >& rhs_dV,
+      std::vector<SmartPtr<Vector> >& sol_xV,
+      std::vector<SmartPtr<Vector> >& sol_sV,
+      std::vector<SmartPtr<Vector> >& sol_cV,
+      std::vector<SmartPtr<Vector> >& sol_dV,
+      bool check_NegEVals,
+      Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues of the full augmented system
+     *  detected during last solve. */
+    virtual Index NumberOfNegEVals() const;
+
+    /** Query whether inertia is computed by linear solver.  This is
+     *  always the case for the dense factorization. */
+    virtual bool ProvidesInertia() const
+    {
+      return true;
+    }
+
+    /** Request to increase quality of solution for next solve.  The
+     *  pivoting strategy of the dense factorization is fixed, so that
+     *  this always returns false. */
+    virtual bool IncreaseQuality()
+    {
+      return false;
+    }
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Copy Constructor */
+    CondensedAugSystemSolver(const CondensedAugSystemSolver&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const CondensedAugSystemSolver&);
+    //@}
+
+    /** Compute the positions of the elements of W and J_c in the
+     *  condensed matrix, and sort the elements of J_d by rows. */
+    void AnalyzeStructure(const SymMatrix& W,
+                          const Matrix& J_c,
+                          const Matrix& J_d);
+
+    /** Form the condensed matrix and compute its factorization */
+    ESymSolverStatus Factorize(const SymMatrix* W,
+                               double W_factor,
+                               const Vector* D_x,
+                               double delta_x,
+                               const Vector* D_s,
+                               double delta_s,
+                               const Matrix& J_c,
+                               const Vector* D_c,
+                               double delta_c,
+                               const Matrix& J_d,
+                               const Vector* D_d,
+                               double delta_d);
+
+    /** Check the internal tags and decide if the passed variables are
+     *  different from what has been factorized most recently. */
+    bool AugmentedSystemRequiresChange(const SymMatrix* W,
+                                       double W_factor,
+                                       const Vector* D_x,
+                                       double delta_x,
+                                       const Vector* D_s,
+                                       double delta_s,
+                                       const Matrix& J_c,
+                                       const Vector* D_c,
+                                       double delta_c,
+                                       const Matrix& J_d,
+                                       const Vector* D_d,
+                                       double delta_d);
+
+    /** Flag indicating whether the structure has been analyzed */
+    bool structure_analyzed_;
+
+    /** @name Structure of the condensed system */
+    //@{
+    /** Dimensions of the parts of the augmented system */
+    Index n_x_;
+    Index n_c_;
+    Index n_d_;
+    /** Dimension of the condensed system (n_x_ + n_c_) */
+    Index n_red_;
+    /** Number of elements of W */
+    Index nnz_w_;
+    /** Number of elements of J_c */
+    Index nnz_jac_c_;
+    /** Number of elements of J_d */
+    Index nnz_jac_d_;
+    /** Positions of the elements of W and J_c (in this order) in
+     *  the dense condensed matrix */
+    std::vector<Index> dense_pos_;
+    /** Row and column (starting at 0) of the elements of J_d */
+    std::vector<Index> jd_row_;
+    std::vector<Index> jd_col_;
+    /** Elements of J_d sorted by rows; the elements of row i are
+     *  jd_order_[jd_row_start_[i]] to
+     *  jd_order_[jd_row_start_[i+1]-1]. */
+    std::vector<Index> jd_order_;
+    std::vector<Index> jd_row_start_;
+    //@}
+
+    /** @name Numerical values */
+    //@{
+    /** Factor of the condensed system computed by DSYTRF */
+    std::vector<Number> factor_;
+    /** Pivot information from DSYTRF */
+    std::vector<Index> ipiv_;
+    /** Values of the elements of W, J_c and J_d (in this order) */
+    std::vector<Number> vals_;
+    /** Inverse of the diagonal D_s + delta_s I */
+    std::vector<Number> inv_sigma_s_;
+    /** Inverse of the diagonal E */
+    std::vector<Number> inv_e_;
+    /** Flag indicating whether the current values have been
+     *  factorized successfully */
+    bool factorized_;
+    /** Number of negative eigenvalues of the full augmented system
+     *  for the most recent factorization */
+    Index num_neg_evals_;
+    //@}
+
+    /**@name Tags and values to track in order to decide whether the
+       matrix has to be updated compared to the most recent call of
+       the Set method.
+     */
+    //@{
+    TaggedObject::Tag w_tag_;
+    double w_factor_;
+    TaggedObject::Tag d_x_tag_;
+    double delta_x_;
+    TaggedObject::Tag d_s_tag_;
+    double delta_s_;
+    TaggedObject::Tag j_c_tag_;
+    TaggedObject::Tag d_c_tag_;
+    double delta_c_;
+    TaggedObject::Tag j_d_tag_;
+    TaggedObject::Tag d_d_tag_;
+    double delta_d_;
+    //@}
+  };
+
+} // namespace Ipopt
+
+#endif
@@ -0,0 +1,462 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpDenseAugSystemSolver.hpp"
+#include "IpTripletHelper.hpp"
+#include "IpLapack.hpp"
+#include "IpBlas.hpp"
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  DenseAugSystemSolver::DenseAugSystemSolver(SmartPtr<SparseAugSystemSolverCreator> sparse_creator /*=NULL*/)
+      :
+      AugSystemSolver(),
+      sparse_creator_(sparse_creator),
+      structure_analyzed_(false),
+      use_dense_(false),
+      n_x_(0),
+      n_s_(0),
+      n_c_(0),
+      n_d_(0),
+      n_aug_(0),
+      nnz_w_(0),
+      nnz_jac_c_(0),
+      nnz_jac_d_(0),
+      factorized_(false),
+      num_neg_evals_(-1),
+      w_tag_(0),
+      w_factor_(0.),
+      d_x_tag_(0),
+      delta_x_(0.),
+      d_s_tag_(0),
+      delta_s_(0.),
+      j_c_tag_(0),
+      d_c_tag_(0),
+      delta_c_(0.),
+      j_d_tag_(0),
+      d_d_tag_(0),
+      delta_d_(0.)
+  {
+    DBG_START_METH("DenseAugSystemSolver::DenseAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  DenseAugSystemSolver::~DenseAugSystemSolver()
+  {
+    DBG_START_METH("DenseAugSystemSolver::~DenseAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  void DenseAugSystemSolver::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddLowerBoundedIntegerOption(
+      "dense_aug_system_max_dim",
+      "Largest augmented system for which a dense factorization is chosen automatically.",
+      0, 1000,
+      "If \"aug_system_solver\" is set to \"auto\", the augmented system is "
+      "factorized with the dense LAPACK routine DSYTRF if its dimension is "
+      "not larger than this value and its density is at least "
+      "\"dense_aug_system_min_density\".");
+    roptions->AddBoundedNumberOption(
+      "dense_aug_system_min_density",
+      "Smallest density of the augmented system for which a dense factorization is chosen automatically.",
+      0., false, 1., false, 0.25,
+      "The density is the fraction of the elements in the lower triangle "
+      "of the augmented system that are structurally nonzero.  See also "
+      "\"dense_aug_system_max_dim\".");
+  }
+
+  bool DenseAugSystemSolver::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetIntegerValue("dense_aug_system_max_dim", max_dim_, prefix);
+    options.GetNumericValue("dense_aug_system_min_density", min_density_,
+                            prefix);
+
+    // This option is registered by OrigIpoptNLP
+    bool warm_start_same_structure;
+    options.GetBoolValue("warm_start_same_structure",
+                         warm_start_same_structure, prefix);
+    if (!warm_start_same_structure) {
+      structure_analyzed_ = false;
+      use_dense_ = false;
+      n_aug_ = 0;
+      dense_pos_.clear();
+    }
+    else {
+      ASSERT_EXCEPTION(structure_analyzed_, INVALID_WARMSTART,
+                       "DenseAugSystemSolver called with warm_start_same_structure, but the structure of the augmented system has not been analyzed.");
+    }
+
+    factorized_ = false;
+
+    // The sparse solver is initialized when it is created
+    sparse_options_ = options;
+    sparse_prefix_ = prefix;
+    if (IsValid(sparse_solver_)) {
+      return sparse_solver_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
+                                        options, prefix);
+    }
+    return true;
+  }
+
+  ESymSolverStatus DenseAugSystemSolver::MultiSolve(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix* J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix* J_d,
+    const Vector* D_d,
+    double delta_d,
+    std::vector<SmartPtr<const Vector> >& rhs_xV,
+    std::vector<SmartPtr<const Vector> >& rhs_sV,
+    std::vector<SmartPtr<const Vector> >& rhs_cV,
+    std::vector<SmartPtr<const Vector> >& rhs_dV,
+    std::vector<SmartPtr<Vector> >& sol_xV,
+    std::vector<SmartPtr<Vector> >& sol_sV,
+    std::vector<SmartPtr<Vector> >& sol_cV,
+    std::vector<SmartPtr<Vector> >& sol_dV,
+    bool check_NegEVals,
+    Index numberOfNegEVals)
+  {
+    DBG_START_METH("DenseAugSystemSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(J_c && J_d && "Currently, you MUST specify J_c and J_d in the augmented system");
+
+    if (!structure_analyzed_) {
+      DBG_ASSERT(W && "W must be given during the first call to set up the structure");
+      use_dense_ = AnalyzeStructure(*W, *J_c, *J_d);
+      structure_analyzed_ = true;
+      if (!use_dense_ && IsNull(sparse_solver_)) {
+        sparse_solver_ = sparse_creator_->CreateSparseSolver(Jnlst(),
+                         sparse_options_,
+                         sparse_prefix_);
+        if (!sparse_solver_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
+                                        sparse_options_, sparse_prefix_)) {
+          sparse_solver_ = NULL;
+          structure_analyzed_ = false;
+          return SYMSOLVER_FATAL_ERROR;
+        }
+      }
+    }
+
+    if (!use_dense_) {
+      return sparse_solver_->MultiSolve(W, W_factor, D_x, delta_x, D_s, delta_s,
+                                        J_c, D_c, delta_c, J_d, D_d, delta_d,
+                                        rhs_xV, rhs_sV, rhs_cV, rhs_dV,
+                                        sol_xV, sol_sV, sol_cV, sol_dV,
+                                        check_NegEVals, numberOfNegEVals);
+    }
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().Start();
+
+    if (!factorized_ ||
+        AugmentedSystemRequiresChange(W, W_factor, D_x, delta_x, D_s, delta_s,
+                                      *J_c, D_c, delta_c, *J_d, D_d, delta_d)) {
+      ESymSolverStatus retval =
+        Factorize(W, W_factor, D_x, delta_x, D_s, delta_s, *J_c, D_c, delta_c,
+                  *J_d, D_d, delta_d);
+      if (retval != SYMSOLVER_SUCCESS) {
+        IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+        return retval;
+      }
+    }
+
+    if (check_NegEVals && num_neg_evals_ != numberOfNegEVals) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Wrong inertia: required are %d, but we got %d.\n",
+                     numberOfNegEVals, num_neg_evals_);
+      IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+      return SYMSOLVER_WRONG_INERTIA;
+    }
+
+    // Solve for all right hand sides at once
+    const Index nrhs = (Index)rhs_xV.size();
+    const Index off_s = n_x_;
+    const Index off_c = off_s + n_s_;
+    const Index off_d = off_c + n_c_;
+    std::vector<Number> rhs(n_aug_*nrhs);
+    for (Index i=0; i<nrhs; i++) {
+      Number* rhs_i = &rhs[i*n_aug_];
+      TripletHelper::FillValuesFromVector(n_x_, *rhs_xV[i], rhs_i);
+      TripletHelper::FillValuesFromVector(n_s_, *rhs_sV[i], rhs_i + off_s);
+      TripletHelper::FillValuesFromVector(n_c_, *rhs_cV[i], rhs_i + off_c);
+      TripletHelper::FillValuesFromVector(n_d_, *rhs_dV[i], rhs_i + off_d);
+    }
+
+    IpData().TimingStats().LinearSystemBackSolve().Start();
+    IpLapackDsytrs(n_aug_, nrhs, &factor_[0], n_aug_, &ipiv_[0], &rhs[0],
+                   n_aug_);
+    IpData().TimingStats().LinearSystemBackSolve().End();
+
+    for (Index i=0; i<nrhs; i++) {
+      const Number* sol_i = &rhs[i*n_aug_];
+      TripletHelper::PutValuesInVector(n_x_, sol_i, *sol_xV[i]);
+      TripletHelper::PutValuesInVector(n_s_, sol_i + off_s, *sol_sV[i]);
+      TripletHelper::PutValuesInVector(n_c_, sol_i + off_c, *sol_cV[i]);
+      TripletHelper::PutValuesInVector(n_d_, sol_i + off_d, *sol_dV[i]);
+    }
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+    return SYMSOLVER_SUCCESS;
+  }
+
+  bool DenseAugSystemSolver::AnalyzeStructure(const SymMatrix& W,
+      const Matrix& J_c,
+      const Matrix& J_d)
+  {
+    DBG_START_METH("DenseAugSystemSolver::AnalyzeStructure", dbg_verbosity);
+
+    n_x_ = J_c.NCols();
+    n_c_ = J_c.NRows();
+    n_d_ = J_d.NRows();
+    n_s_ = n_d_;
+    n_aug_ = n_x_ + n_s_ + n_c_ + n_d_;
+
+    if (IsValid(sparse_creator_) && n_aug_ > max_dim_) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Augmented system of dimension %d is too large for the dense factorization.\n",
+                     n_aug_);
+      return false;
+    }
+
+    nnz_w_ = TripletHelper::GetNumberEntries(W);
+    nnz_jac_c_ = TripletHelper::GetNumberEntries(J_c);
+    nnz_jac_d_ = TripletHelper::GetNumberEntries(J_d);
+    const Index nnz = nnz_w_ + nnz_jac_c_ + nnz_jac_d_;
+
+    std::vector<Index> irow(nnz+1);
+    std::vector<Index> jcol(nnz+1);
+    TripletHelper::FillRowCol(nnz_w_, W, &irow[0], &jcol[0]);
+    TripletHelper::FillRowCol(nnz_jac_c_, J_c, &irow[nnz_w_], &jcol[nnz_w_],
+                              n_x_ + n_s_, 0);
+    TripletHelper::FillRowCol(nnz_jac_d_, J_d, &irow[nnz_w_ + nnz_jac_c_],
+                              &jcol[nnz_w_ + nnz_jac_c_],
+                              n_x_ + n_s_ + n_c_, 0);
+
+    dense_pos_.resize(nnz+1);
+    for (Index e=0; e<nnz; e++) {
+      Index r = irow[e] - 1;
+      Index c = jcol[e] - 1;
+      if (r >= c) {
+        dense_pos_[e] = r + c*n_aug_;
+      }
+      else {
+        dense_pos_[e] = c + r*n_aug_;
+      }
+    }
+
+    if (IsValid(sparse_creator_)) {
+      // Count the structurally nonzero elements in the lower
+      // triangle: the diagonal, the identity between d and s, and
+      // the distinct elements of W, J_c and J_d.
+      std::vector<bool> nonzero(n_aug_*n_aug_, false);
+      Index nnz_lower = n_aug_ + n_d_;
+      for (Index e=0; e<nnz; e++) {
+        Index pos = dense_pos_[e];
+        if (!nonzero[pos] && pos%n_aug_ != pos/n_aug_) {
+          nonzero[pos] = true;
+          nnz_lower++;
+        }
+      }
+      Number density = (Number)nnz_lower/
+                       (0.5*(Number)n_aug_*(Number)(n_aug_+1));
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Augmented system of dimension %d has density %e.\n",
+                     n_aug_, density);
+      if (density < min_density_) {
+        return false;
+      }
+    }
+
+    factor_.resize(n_aug_*n_aug_);
+    ipiv_.resize(n_aug_);
+    vals_.resize(nnz+1);
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Using dense factorization for the augmented system.\n");
+    return true;
+  }
+
+  ESymSolverStatus DenseAugSystemSolver::Factorize(const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix& J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix& J_d,
+      const Vector* D_d,
+      double delta_d)
+  {
+    DBG_START_METH("DenseAugSystemSolver::Factorize", dbg_verbosity);
+
+    factorized_ = false;
+
+    // Assemble the lower triangle of the augmented system
+    const Number zero = 0.;
+    IpBlasDcopy(n_aug_*n_aug_, &zero, 0, &factor_[0], 1);
+
+    Index nnz = 0;
+    if (W && W_factor != 0.) {
+      DBG_ASSERT(TripletHelper::GetNumberEntries(*W) == nnz_w_);
+      TripletHelper::FillValues(nnz_w_, *W, &vals_[0]);
+      for (Index e=0; e<nnz_w_; e++) {
+        factor_[dense_pos_[e]] += W_factor*vals_[e];
+      }
+    }
+    nnz += nnz_w_;
+    TripletHelper::FillValues(nnz_jac_c_, J_c, &vals_[nnz]);
+    TripletHelper::FillValues(nnz_jac_d_, J_d, &vals_[nnz + nnz_jac_c_]);
+    for (Index e=nnz; e<nnz + nnz_jac_c_ + nnz_jac_d_; e++) {
+      factor_[dense_pos_[e]] += vals_[e];
+    }
+
+    const Index off_s = n_x_;
+    const Index off_c = off_s + n_s_;
+    const Index off_d = off_c + n_c_;
+    std::vector<Number> diag(n_aug_);
+    if (D_x) {
+      TripletHelper::FillValuesFromVector(n_x_, *D_x, &diag[0]);
+    }
+    if (D_s) {
+      TripletHelper::FillValuesFromVector(n_s_, *D_s, &diag[0] + off_s);
+    }
+    if (D_c) {
+      TripletHelper::FillValuesFromVector(n_c_, *D_c, &diag[0] + off_c);
+    }
+    if (D_d) {
+      TripletHelper::FillValuesFromVector(n_d_, *D_d, &diag[0] + off_d);
+    }
+    for (Index i=0; i<n_x_; i++) {
+      factor_[i*(n_aug_+1)] += diag[i] + delta_x;
+    }
+    for (Index i=off_s; i<off_c; i++) {
+      factor_[i*(n_aug_+1)] += diag[i] + delta_s;
+    }
+    for (Index i=off_c; i<off_d; i++) {
+      factor_[i*(n_aug_+1)] += diag[i] - delta_c;
+    }
+    for (Index i=off_d; i<n_aug_; i++) {
+      factor_[i*(n_aug_+1)] += diag[i] - delta_d;
+      // the -I between d and s
+      factor_[i + (i - n_c_ - n_s_)*n_aug_] = -1.;
+    }
+
+    // Remember the tags and values of this system
+    w_tag_ = W ? W->GetTag() : 0;
+    w_factor_ = W_factor;
+    d_x_tag_ = D_x ? D_x->GetTag() : 0;
+    delta_x_ = delta_x;
+    d_s_tag_ = D_s ? D_s->GetTag() : 0;
+    delta_s_ = delta_s;
+    j_c_tag_ = J_c.GetTag();
+    d_c_tag_ = D_c ? D_c->GetTag() : 0;
+    delta_c_ = delta_c;
+    j_d_tag_ = J_d.GetTag();
+    d_d_tag_ = D_d ? D_d->GetTag() : 0;
+    delta_d_ = delta_d;
+
+    Index info;
+    IpData().TimingStats().LinearSystemFactorization().Start();
+    IpLapackDsytrf(n_aug_, &factor_[0], n_aug_, &ipiv_[0], num_neg_evals_,
+                   info);
+    IpData().TimingStats().LinearSystemFactorization().End();
+    if (info < 0) {
+      Jnlst().Printf(J_ERROR, J_LINEAR_ALGEBRA,
+                     "Error in DSYTRF: info = %d\n", info);
+      return SYMSOLVER_FATAL_ERROR;
+    }
+    if (info > 0) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Dense augmented system is singular (info = %d).\n",
+                     info);
+      return SYMSOLVER_SINGULAR;
+    }
+
+    factorized_ = true;
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Factorization successful, number of negative eigenvalues = %d\n",
+                   num_neg_evals_);
+    return SYMSOLVER_SUCCESS;
+  }
+
+  bool DenseAugSystemSolver::AugmentedSystemRequiresChange(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix& J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix& J_d,
+    const Vector* D_d,
+    double delta_d)
+  {
+    if ( (W && W->GetTag() != w_tag_)
+         || (!W && w_tag_ != 0)
+         || (W_factor != w_factor_)
+         || (D_x && D_x->GetTag() != d_x_tag_)
+         || (!D_x && d_x_tag_ != 0)
+         || (delta_x != delta_x_)
+         || (D_s && D_s->GetTag() != d_s_tag_)
+         || (!D_s && d_s_tag_ != 0)
+         || (delta_s != delta_s_)
+         || (J_c.GetTag() != j_c_tag_)
+         || (D_c && D_c->GetTag() != d_c_tag_)
+         || (!D_c && d_c_tag_ != 0)
+         || (delta_c != delta_c_)
+         || (J_d.GetTag() != j_d_tag_)
+         || (D_d && D_d->GetTag() != d_d_tag_)
+         || (!D_d && d_d_tag_ != 0)
+         || (delta_d != delta_d_) ) {
+      return true;
+    }
+
+    return false;
+  }
+
+  Index DenseAugSystemSolver::NumberOfNegEVals() const
+  {
+    if (!use_dense_) {
+      DBG_ASSERT(IsValid(sparse_solver_));
+      return sparse_solver_->NumberOfNegEVals();
+    }
+    DBG_ASSERT(factorized_);
+    return num_neg_evals_;
+  }
+
+  bool DenseAugSystemSolver::ProvidesInertia() const
+  {
+    // Before the first solve, it is not yet known which
+    // factorization is used
+    if (IsValid(sparse_solver_) && structure_analyzed_ && !use_dense_) {
+      return sparse_solver_->ProvidesInertia();
+    }
+    return true;
+  }
+
+  bool DenseAugSystemSolver::IncreaseQuality()
+  {
+    if (IsValid(sparse_solver_) && structure_analyzed_ && !use_dense_) {
+      return sparse_solver_->IncreaseQuality();
+    }
+    return false;
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,262 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IP_DENSEAUGSYSTEMSOLVER_HPP__
+#define __IP_DENSEAUGSYSTEMSOLVER_HPP__
+
+#include "IpAugSystemSolver.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** Interface for creating the augmented system solver that
+   *  DenseAugSystemSolver uses for systems that are too large or too
+   *  sparse.  The solver is only created once this has been decided,
+   *  so that a sparse linear solver that is not available does not
+   *  prevent the dense factorization of small systems. */
+  class SparseAugSystemSolverCreator : public ReferencedObject
+  {
+  public:
+    /** Default constructor */
+    SparseAugSystemSolverCreator()
+    {}
+
+    /** Default destructor */
+    virtual ~SparseAugSystemSolverCreator()
+    {}
+
+    /** Create the sparse augmented system solver */
+    virtual SmartPtr<AugSystemSolver> CreateSparseSolver(
+      const Journalist& jnlst,
+      const OptionsList& options,
+      const std::string& prefix) = 0;
+
+  private:
+    /** Copy Constructor */
+    SparseAugSystemSolverCreator(const SparseAugSystemSolverCreator&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const SparseAugSystemSolverCreator&);
+  };
+
+  /** Solver for the augmented system of small problems with dense
+   *  derivative matrices.  The augmented system is assembled directly
+   *  into a dense array (lower triangle, column-major), which is
+   *  factorized with the Bunch-Kaufman method of the LAPACK routine
+   *  DSYTRF.  The inertia is obtained from the block diagonal factor.
+   *  This avoids the overhead of the triplet and compressed formats
+   *  required by the sparse linear solvers.
+   *
+   *  If a creator for a sparse augmented system solver is given to
+   *  the constructor, the decision whether the dense factorization is
+   *  used is made at the first call of MultiSolve, based on the
+   *  dimension and the density of the augmented system (see options
+   *  dense_aug_system_max_dim and dense_aug_system_min_density); if
+   *  the system is too large or too sparse, the sparse solver is
+   *  created and all calls are passed on to it.
+   */
+  class DenseAugSystemSolver : public AugSystemSolver
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Constructor.  If sparse_creator is not NULL, it is used to
+     *  create the solver for augmented systems that are not suitable
+     *  for a dense factorization. */
+    DenseAugSystemSolver(SmartPtr<SparseAugSystemSolverCreator> sparse_creator = NULL);
+
+    /** Default destructor */
+    virtual ~DenseAugSystemSolver();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** Set up the augmented system and solve it for a set of given
+     *  right hand sides. */
+    virtual ESymSolverStatus MultiSolve(
+      const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix* J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix* J_d,
+      const Vector* D_d,
+      double delta_d,
+      std::vector<SmartPtr<const Vector> >& rhs_xV,
+      std::vector<SmartPtr<const Vector> >& rhs_sV,
+      std::vector<SmartPtr<const Vector> >& rhs_cV,
+      std::vector<SmartPtr<const Vector> >& rhs_dV,
+      std::vector<SmartPtr<Vector> >& sol_xV,
+      std::vector<SmartPtr<Vector> >& sol_sV,
+      std::vector<SmartPtr<Vector> >& sol_cV,
+      std::vector<SmartPtr<Vector> >& sol_dV,
+      bool check_NegEVals,
+      Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last
+     *  solve. */
+    virtual Index NumberOfNegEVals() const;
+
+    /** Query whether inertia is computed by linear solver.  This is
+     *  always the case for the dense factorization. */
+    virtual bool ProvidesInertia() const;
+
+    /** Request to increase quality of solution for next solve.  The
+     *  pivoting strategy of the dense factorization is fixed, so that
+     *  this returns false unless the sparse solver is used. */
+    virtual bool IncreaseQuality();
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Copy Constructor */
+    DenseAugSystemSolver(const DenseAugSystemSolver&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const DenseAugSystemSolver&);
+    //@}
+
+    /** Compute the positions of the elements of the augmented system
+     *  in the dense matrix.  Returns true if the dense factorization
+     *  should be used for this system. */
+    bool AnalyzeStructure(const SymMatrix& W,
+                          const Matrix& J_c,
+                          const Matrix& J_d);
+
+    /** Assemble the dense matrix and compute its factorization */
+    ESymSolverStatus Factorize(const SymMatrix* W,
+                               double W_factor,
+                               const Vector* D_x,
+                               double delta_x,
+                               const Vector* D_s,
+                               double delta_s,
+                               const Matrix& J_c,
+                               const Vector* D_c,
+                               double delta_c,
+                               const Matrix& J_d,
+                               const Vector* D_d,
+                               double delta_d);
+
+    /** Check the internal tags and decide if the passed variables are
+     *  different from what has been factorized most recently. */
+    bool AugmentedSystemRequiresChange(const SymMatrix* W,
+                                       double W_factor,
+                                       const Vector* D_x,
+                                       double delta_x,
+                                       const Vector* D_s,
+                                       double delta_s,
+                                       const Matrix& J_c,
+                                       const Vector* D_c,
+                                       double delta_c,
+                                       const Matrix& J_d,
+                                       const Vector* D_d,
+                                       double delta_d);
+
+    /** Creator of the solver for systems that are not solved with
+     *  the dense factorization */
+    SmartPtr<SparseAugSystemSolverCreator> sparse_creator_;
+    /** Solver used if the system is not solved with the dense
+     *  factorization (created when it is needed first) */
+    SmartPtr<AugSystemSolver> sparse_solver_;
+    /** Options and prefix for initializing the sparse solver */
+    //@{
+    OptionsList sparse_options_;
+    std::string sparse_prefix_;
+    //@}
+
+    /** Flag indicating whether the structure has been analyzed */
+    bool structure_analyzed_;
+    /** Flag indicating whether the dense factorization is used */
+    bool use_dense_;
+
+    /** @name Structure of the augmented system */
+    //@{
+    /** Dimensions of the parts of the augmented system */
+    Index n_x_;
+    Index n_s_;
+    Index n_c_;
+    Index n_d_;
+    /** Dimension of the augmented system */
+    Index n_aug_;
+    /** Number of elements of W */
+    Index nnz_w_;
+    /** Number of elements of J_c */
+    Index nnz_jac_c_;
+    /** Number of elements of J_d */
+    Index nnz_jac_d_;
+    /** Positions of the elements of W, J_c and J_d (in this order) in
+     *  the dense matrix */
+    std::vector<Index> dense_pos_;
+    //@}
+
+    /** @name Numerical values */
+    //@{
+    /** Factor of the augmented system computed by DSYTRF */
+    std::vector<Number> factor_;
+    /** Pivot information from DSYTRF */
+    std::vector<Index> ipiv_;
+    /** Work space for the values of matrix elements */
+    std::vector<Number> vals_;
+    /** Flag indicating whether the current values have been
+     *  factorized successfully */
+    bool factorized_;
+    /** Number of negative eigenvalues of the most recent
+     *  factorization */
+    Index num_neg_evals_;
+    //@}
+
+    /**@name Tags and values to track in order to decide whether the
+       matrix has to be updated compared to the most recent call of
+       the Set method.
+     */
+    //@{
+    TaggedObject::Tag w_tag_;
+    double w_factor_;
+    TaggedObject::Tag d_x_tag_;
+    double delta_x_;
+    TaggedObject::Tag d_s_tag_;
+    double delta_s_;
+    TaggedObject::Tag j_c_tag_;
+    TaggedObject::Tag d_c_tag_;
+    double delta_c_;
+    TaggedObject::Tag j_d_tag_;
+    TaggedObject::Tag d_d_tag_;
+    double delta_d_;
+    //@}
+
+    /** @name Algorithmic parameters */
+    //@{
+    /** Largest dimension of the augmented system for which the dense
+     *  factorization is chosen automatically */
+    Index max_dim_;
+    /** Smallest density of the augmented system for which the dense
+     *  factorization is chosen automatically */
+    Number min_density_;
+    //@}
+  };
+
+} // namespace Ipopt
+
+#endif
@@ -0,0 +1,73 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpHessianProductMatrix.hpp"
+#include "IpIpoptNLP.hpp"
+
+namespace Ipopt
+{
+
+  HessianProductMatrix::HessianProductMatrix(const HessianProductMatrixSpace* owner_space)
+      :
+      SymMatrix(owner_space),
+      obj_factor_(0.)
+  {}
+
+  HessianProductMatrix::~HessianProductMatrix()
+  {}
+
+  void HessianProductMatrix::SetPoint(const SmartPtr<NLP>& nlp,
+                                      const SmartPtr<const Vector>& x,
+                                      Number obj_factor,
+                                      const SmartPtr<const Vector>& yc,
+                                      const SmartPtr<const Vector>& yd)
+  {
+    nlp_ = nlp;
+    x_ = x;
+    obj_factor_ = obj_factor;
+    yc_ = yc;
+    yd_ = yd;
+    ObjectChanged();
+  }
+
+  void HessianProductMatrix::MultVectorImpl(Number alpha, const Vector &x,
+      Number beta, Vector &y) const
+  {
+    DBG_ASSERT(IsValid(nlp_));
+    SmartPtr<Vector> h_x = y.MakeNew();
+    bool success = nlp_->Eval_h_prod(*x_, obj_factor_, *yc_, *yd_, x, *h_x);
+    ASSERT_EXCEPTION(success, IpoptNLP::Eval_Error,
+                     "Error evaluating the product with the hessian of the lagrangian");
+    y.AddOneVector(alpha, *h_x, beta);
+  }
+
+  void HessianProductMatrix::ComputeRowAMaxImpl(Vector& rows_norms, bool init) const
+  {
+    THROW_EXCEPTION(UNIMPLEMENTED_LINALG_METHOD_CALLED,
+                    "HessianProductMatrix::ComputeRowAMaxImpl not implemented");
+  }
+
+  void HessianProductMatrix::ComputeColAMaxImpl(Vector& cols_norms, bool init) const
+  {
+    THROW_EXCEPTION(UNIMPLEMENTED_LINALG_METHOD_CALLED,
+                    "HessianProductMatrix::ComputeColAMaxImpl not implemented");
+  }
+
+  void HessianProductMatrix::PrintImpl(const Journalist& jnlst,
+                                       EJournalLevel level,
+                                       EJournalCategory category,
+                                       const std::string& name,
+                                       Index indent,
+                                       const std::string& prefix) const
+  {
+    jnlst.Printf(level, category, "\n");
+    jnlst.PrintfIndented(level, category, indent,
+                         "%sHessianProductMatrix \"%s\" of dimension %d (only available as operator) with obj_factor %23.16e.\n",
+                         prefix.c_str(), name.c_str(), Dim(), obj_factor_);
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,137 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IPHESSIANPRODUCTMATRIX_HPP__
+#define __IPHESSIANPRODUCTMATRIX_HPP__
+
+#include "IpSymMatrix.hpp"
+#include "IpNLP.hpp"
+
+namespace Ipopt
+{
+
+  /* forward declarations */
+  class HessianProductMatrixSpace;
+
+  /** Class for the Hessian of the Lagrangian that is only available
+   *  as an operator.  The matrix stores the point (x, obj_factor,
+   *  yc, yd) at which the Hessian is to be evaluated, and every
+   *  product with a vector is computed by the Eval_h_prod method of
+   *  the NLP.  The elements of the matrix are not known, so that
+   *  this matrix can only be used by algorithmic components that
+   *  require nothing but matrix-vector products (such as the
+   *  KrylovAugSystemSolver).
+   */
+  class HessianProductMatrix : public SymMatrix
+  {
+  public:
+
+    /**@name Constructors / Destructors */
+    //@{
+
+    /** Constructor, taking the owner_space.
+     */
+    HessianProductMatrix(const HessianProductMatrixSpace* owner_space);
+
+    /** Destructor */
+    ~HessianProductMatrix();
+    //@}
+
+    /** Set the NLP and the point at which the Hessian is evaluated.
+     *  The vectors are given in the unscaled space of the NLP. */
+    void SetPoint(const SmartPtr<NLP>& nlp,
+                  const SmartPtr<const Vector>& x,
+                  Number obj_factor,
+                  const SmartPtr<const Vector>& yc,
+                  const SmartPtr<const Vector>& yd);
+
+  protected:
+    /**@name Methods overloaded from matrix */
+    //@{
+    virtual void MultVectorImpl(Number alpha, const Vector& x,
+                                Number beta, Vector& y) const;
+
+    /** The row norms are not available; this method throws an
+     *  exception. */
+    virtual void ComputeRowAMaxImpl(Vector& rows_norms, bool init) const;
+
+    /** The column norms are not available; this method throws an
+     *  exception. */
+    virtual void ComputeColAMaxImpl(Vector& cols_norms, bool init) const;
+
+    virtual void PrintImpl(const Journalist& jnlst,
+                           EJournalLevel level,
+                           EJournalCategory category,
+                           const std::string& name,
+                           Index indent,
+                           const std::string& prefix) const;
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    HessianProductMatrix();
+
+    /** Copy Constructor */
+    HessianProductMatrix(const HessianProductMatrix&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const HessianProductMatrix&);
+    //@}
+
+    /** NLP that computes the products */
+    SmartPtr<NLP> nlp_;
+
+    /** @name Point at which the Hessian is evaluated */
+    //@{
+    SmartPtr<const Vector> x_;
+    Number obj_factor_;
+    SmartPtr<const Vector> yc_;
+    SmartPtr<const Vector> yd_;
+    //@}
+  };
+
+  /** Class for matrix space for HessianProductMatrix */
+  class HessianProductMatrixSpace : public SymMatrixSpace
+  {
+  public:
+    /** @name Constructors / Destructors */
+    //@{
+    /** Constructor, given the dimension of the matrix. */
+    HessianProductMatrixSpace(Index dim)
+        :
+        SymMatrixSpace(dim)
+    {}
+
+    /** Destructor */
+    ~HessianProductMatrixSpace()
+    {}
+    //@}
+
+    /** Method for creating a new matrix of this specific type. */
+    HessianProductMatrix* MakeNewHessianProductMatrix() const
+    {
+      return new HessianProductMatrix(this);
+    }
+
+    /** Overloaded MakeNew method for the SymMatrixSpace base class.
+     */
+    virtual SymMatrix* MakeNewSymMatrix() const
+    {
+      return MakeNewHessianProductMatrix();
+    }
+  };
+
+} // namespace Ipopt
+#endif
@@ -247,6 +247,15 @@ namespace Ipopt
       skip_print_problem_stats_ = false;
     }
 
+    // The best iterate of the regular algorithm is returned if the
+    // wallclock time limit is reached
+    Number max_wall_time;
+    my_options->GetNumericValue("max_wall_time", max_wall_time, prefix);
+    track_best_iterate_ = (prefix!="resto." && max_wall_time < 1e20);
+    if (track_best_iterate_) {
+      my_options->GetNumericValue("constr_viol_tol", constr_viol_tol_, prefix);
+    }
+
     return true;
   }
 
@@ -257,8 +266,14 @@ namespace Ipopt
     // Start measuring CPU time
     IpData().TimingStats().OverallAlgorithm().Start();
 
-    // Reset Cpu start time (so doesn't carry over from previous Optimize)
-    IpData().ResetCpuStartTime();
+    // Reset Cpu start time (so doesn't carry over from previous
+    // Optimize).  The restoration phase keeps the start time of the
+    // regular algorithm, so that the time limits apply to the overall
+    // optimization.
+    if (!isResto) {
+      IpData().ResetCpuStartTime();
+    }
+    best_iterate_ = NULL;
 
     if (!copyright_message_printed) {
       print_copyright_message(Jnlst());
@@ -296,6 +311,10 @@ namespace Ipopt
         conv_check_->CheckConvergence();
       IpData().TimingStats().CheckConvergence().End();
 
+      if (track_best_iterate_) {
+        UpdateBestIterate();
+      }
+
       // main loop
       while (conv_status == ConvergenceCheck::CONTINUE) {
         // Set the Hessian Matrix
@@ -359,6 +378,10 @@ namespace Ipopt
         IpData().TimingStats().CheckConvergence().Start();
         conv_status  = conv_check_->CheckConvergence();
         IpData().TimingStats().CheckConvergence().End();
+
+        if (track_best_iterate_) {
+          UpdateBestIterate();
+        }
       }
 
       IpData().TimingStats().OutputIteration().Start();
@@ -386,6 +409,9 @@ namespace Ipopt
       case ConvergenceCheck::CPUTIME_EXCEEDED:
         retval = CPUTIME_EXCEEDED;
         break;
+      case ConvergenceCheck::WALLTIME_EXCEEDED:
+        retval = WALLTIME_EXCEEDED;
+        break;
       case ConvergenceCheck::DIVERGING:
         retval = DIVERGING_ITERATES;
         break;
@@ -437,6 +463,16 @@ namespace Ipopt
       IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
       retval = CPUTIME_EXCEEDED;
     }
+    catch (RESTORATION_WALLTIME_EXCEEDED& exc) {
+      exc.ReportException(Jnlst(), J_MOREDETAILED);
+      IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
+      retval = WALLTIME_EXCEEDED;
+    }
+    catch (WALLTIME_LIMIT_REACHED& exc) {
+      exc.ReportException(Jnlst(), J_MOREDETAILED);
+      IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
+      retval = WALLTIME_EXCEEDED;
+    }
     catch (RESTORATION_USER_STOP& exc) {
       exc.ReportException(Jnlst(), J_MOREDETAILED);
       IpData().TimingStats().ComputeAcceptableTrialPoint().EndIfStarted();
@@ -471,6 +507,10 @@ namespace Ipopt
       retval = INTERNAL_ERROR;
     }
 
+    if (retval == WALLTIME_EXCEEDED && track_best_iterate_) {
+      RestoreBestIterate();
+    }
+
     DBG_ASSERT(retval != UNASSIGNED && "Unknown return code in the algorithm");
     IpData().TimingStats().OverallAlgorithm().End();
     return retval;
@@ -777,6 +817,54 @@ namespace Ipopt
                    ns_only_upper);
   }
 
+  void IpoptAlgorithm::UpdateBestIterate()
+  {
+    DBG_START_METH("IpoptAlgorithm::UpdateBestIterate",
+                   dbg_verbosity);
+
+    Number constr_viol =
+      IpCq().unscaled_curr_nlp_constraint_violation(NORM_MAX);
+    bool feasible = (constr_viol <= constr_viol_tol_);
+    Number measure = feasible ? IpCq().unscaled_curr_f() : constr_viol;
+
+    if (IsNull(best_iterate_) ||
+        (feasible && !best_iterate_feasible_) ||
+        (feasible == best_iterate_feasible_ &&
+         measure < best_iterate_measure_)) {
+      DBG_PRINT((1, "New best iterate with feasible = %d and measure = %e\n",
+                 feasible, measure));
+      best_iterate_ = IpData().curr();
+      best_iterate_feasible_ = feasible;
+      best_iterate_measure_ = measure;
+    }
+  }
+
+  void IpoptAlgorithm::RestoreBestIterate()
+  {
+    DBG_START_METH("IpoptAlgorithm::RestoreBestIterate",
+                   dbg_verbosity);
+
+    if (IsNull(best_iterate_) ||
+        GetRawPtr(best_iterate_) == GetRawPtr(IpData().curr())) {
+      return;
+    }
+
+    if (best_iterate_feasible_) {
+      Jnlst().Printf(J_SUMMARY, J_MAIN,
+                     "\nReturning best feasible iterate with objective function value %23.16e.\n",
+                     best_iterate_measure_);
+    }
+    else {
+      Jnlst().Printf(J_SUMMARY, J_MAIN,
+                     "\nReturning least infeasible iterate with constraint violation %23.16e.\n",
+                     best_iterate_measure_);
+    }
+    SmartPtr<IteratesVector> iterate =
+      best_iterate_->MakeNewIteratesVectorCopy();
+    IpData().set_trial(iterate);
+    IpData().AcceptTrialPoint();
+  }
+
   void IpoptAlgorithm::ComputeFeasibilityMultipliers()
   {
     DBG_START_METH("IpoptAlgorithm::ComputeFeasibilityMultipliers",
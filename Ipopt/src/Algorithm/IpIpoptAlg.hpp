@@ -163,12 +163,37 @@ namespace Ipopt
 
     /** Compute the Lagrangian multipliers for a feasibility problem*/
     void ComputeFeasibilityMultipliers();
+
+    /** Remember the current iterate if it is better than the best
+     *  iterate seen so far.  A point satisfying the constraint
+     *  violation tolerance is better than any infeasible point;
+     *  feasible points are compared by their objective function
+     *  value, and infeasible points by their constraint
+     *  violation. */
+    void UpdateBestIterate();
+
+    /** Make the best iterate seen so far the current iterate. */
+    void RestoreBestIterate();
     //@}
 
     /** @name internal flags */
     //@{
     /** Flag indicating if the statistic should not be printed */
     bool skip_print_problem_stats_;
+    /** Flag indicating if the best iterate is tracked so that it can
+     *  be returned when the wallclock time limit is reached */
+    bool track_best_iterate_;
+    //@}
+
+    /** @name Best iterate seen so far (if track_best_iterate_ is
+     *  true) */
+    //@{
+    SmartPtr<const IteratesVector> best_iterate_;
+    /** Flag indicating if best_iterate_ satisfies constr_viol_tol */
+    bool best_iterate_feasible_;
+    /** Objective function value of best_iterate_ if it is feasible,
+     *  and its constraint violation otherwise */
+    Number best_iterate_measure_;
     //@}
 
     /** @name Algorithmic parameters */
@@ -190,6 +215,9 @@ namespace Ipopt
     bool mehrotra_algorithm_;
     /** String specifying linear solver */
     std::string linear_solver_;
+    /** Tolerance on the (unscaled) constraint violation for the best
+     *  iterate to be considered feasible */
+    Number constr_viol_tol_;
     //@}
 
     /** @name auxiliary functions */
@@ -13,9 +13,12 @@ namespace Ipopt
 {
 
   IpoptData::IpoptData(SmartPtr<IpoptAdditionalData> add_data /*= NULL*/,
-                       Number cpu_time_start /*= -1.*/)
+                       Number cpu_time_start /*= -1.*/,
+                       Number wallclock_time_start /*= -1.*/)
       :
       cpu_time_start_(cpu_time_start),
+      wallclock_time_start_(wallclock_time_start),
+      max_wall_time_(1e20),
       add_data_(add_data)
   {}
 
@@ -63,6 +66,7 @@ namespace Ipopt
 #else
     options.GetNumericValue("tol", tol_, prefix);
 #endif
+    options.GetNumericValue("max_wall_time", max_wall_time_, prefix);
 
     iter_count_ = 0;
     curr_mu_ = -1.;
@@ -83,8 +87,11 @@ namespace Ipopt
 
     initialize_called_ = true;
 
-    // will be set to cputime in IpoptApplication::call_optimize()
-    cpu_time_start_ = -1.;
+    // cpu_time_start_ and wallclock_time_start_ are set at the
+    // beginning of IpoptAlgorithm::Optimize; for the restoration
+    // phase, the values of the regular algorithm given to the
+    // constructor are kept so that the time limits apply to the
+    // overall optimization
 
     bool retval = true;
 
@@ -87,7 +87,8 @@ namespace Ipopt
     //@{
     /** Constructor */
     IpoptData(SmartPtr<IpoptAdditionalData> add_data = NULL,
-              Number cpu_time_start = -1.);
+              Number cpu_time_start = -1.,
+              Number wallclock_time_start = -1.);
 
     /** Default destructor */
     virtual ~IpoptData();
@@ -377,6 +378,22 @@ namespace Ipopt
       return cpu_time_start_;
     }
 
+    /** Wallclock time counter at the beginning of the optimization.
+     *  Can only be called after beginning of optimization. */
+    Number wallclock_time_start() const
+    {
+      DBG_ASSERT(wallclock_time_start_ >= 0);
+      return wallclock_time_start_;
+    }
+
+    /** Check whether the wallclock time limit given by the option
+     *  max_wall_time has been exceeded. */
+    bool WallclockTimeExceeded() const
+    {
+      return max_wall_time_ < 1e20 &&
+             WallclockTime() - wallclock_time_start() > max_wall_time_;
+    }
+
     /** @name Information gathered for iteration output */
     //@{
     Number info_regu_x() const
@@ -419,6 +436,14 @@ namespace Ipopt
     {
       info_ls_count_ = ls_count;
     }
+    Index info_inertia_corrections() const
+    {
+      return info_inertia_corrections_;
+    }
+    void Set_info_inertia_corrections(Index inertia_corrections)
+    {
+      info_inertia_corrections_ = inertia_corrections;
+    }
     bool info_skip_output() const
     {
       return info_skip_output_;
@@ -475,6 +500,7 @@ namespace Ipopt
       info_alpha_primal_ = 0;
       info_alpha_dual_ = 0.;
       info_alpha_primal_char_ = ' ';
+      info_inertia_corrections_ = 0;
       info_skip_output_ = false;
       info_string_.erase();
     }
@@ -486,10 +512,11 @@ namespace Ipopt
       return timing_statistics_;
     }
 
-    /** Resetting CPU Start Time */
+    /** Resetting CPU and wallclock Start Time */
     void ResetCpuStartTime()
     {
       cpu_time_start_ = CpuTime();
+      wallclock_time_start_ = WallclockTime();
     }
 
     /** Check if additional data has been set */
@@ -626,6 +653,9 @@ namespace Ipopt
     Number info_alpha_dual_;
     /** Number of backtracking trial steps */
     Index info_ls_count_;
+    /** Number of additional factorizations of the KKT matrix with
+     *  modified perturbations (inertia correction) */
+    Index info_inertia_corrections_;
     /** true, if next summary output line should not be printed (eg
      *  after restoration phase. */
     bool info_skip_output_;
@@ -648,6 +678,12 @@ namespace Ipopt
     /** CPU time counter at begin of optimization. */
     Number cpu_time_start_;
 
+    /** Wallclock time counter at begin of optimization. */
+    Number wallclock_time_start_;
+
+    /** Maximal wallclock time for the optimization */
+    Number max_wall_time_;
+
     /** Object for the data specific for the Chen-Goldfarb penalty
      *  method algorithm */
     SmartPtr<IpoptAdditionalData> add_data_;
@@ -0,0 +1,530 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpKrylovAugSystemSolver.hpp"
+#include "IpTripletHelper.hpp"
+
+#include <algorithm>
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  KrylovAugSystemSolver::KrylovAugSystemSolver()
+      :
+      AugSystemSolver(),
+      n_x_(0),
+      n_c_(0),
+      n_d_(0),
+      nnz_w_(0),
+      nnz_jac_c_(0),
+      nnz_jac_d_(0),
+      w_tag_(0),
+      w_factor_(0.),
+      d_x_tag_(0),
+      delta_x_(0.),
+      d_s_tag_(0),
+      delta_s_(0.),
+      j_c_tag_(0),
+      d_c_tag_(0),
+      delta_c_(0.),
+      j_d_tag_(0),
+      d_d_tag_(0),
+      delta_d_(0.),
+      w_products_only_(false)
+  {
+    DBG_START_METH("KrylovAugSystemSolver::KrylovAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  KrylovAugSystemSolver::~KrylovAugSystemSolver()
+  {
+    DBG_START_METH("KrylovAugSystemSolver::~KrylovAugSystemSolver()",
+                   dbg_verbosity);
+  }
+
+  void KrylovAugSystemSolver::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
+  {
+    roptions->AddLowerBoundedIntegerOption(
+      "krylov_max_iter",
+      "Maximal number of MINRES iterations.",
+      1, 1000,
+      "Maximal number of iterations of the MINRES method used for the "
+      "augmented system if \"aug_system_solver\" is \"krylov\".");
+    roptions->AddBoundedNumberOption(
+      "krylov_tol",
+      "Relative tolerance for the MINRES method.",
+      0., true, 1., true, 1e-8,
+      "The MINRES method used for the augmented system if "
+      "\"aug_system_solver\" is \"krylov\" terminates if the norm of the "
+      "preconditioned residual has been reduced by this factor.  If the "
+      "residual of the resulting step is too large, the tolerance is "
+      "decreased by a factor of 100, down to \"krylov_min_tol\".  It is "
+      "reset to this value for each new augmented system.");
+    roptions->AddBoundedNumberOption(
+      "krylov_min_tol",
+      "Smallest relative tolerance for the MINRES method.",
+      0., true, 1., true, 1e-14,
+      "See \"krylov_tol\".");
+  }
+
+  bool KrylovAugSystemSolver::InitializeImpl(const OptionsList& options,
+      const std::string& prefix)
+  {
+    options.GetIntegerValue("krylov_max_iter", max_iter_, prefix);
+    options.GetNumericValue("krylov_tol", tol_, prefix);
+    options.GetNumericValue("krylov_min_tol", min_tol_, prefix);
+    curr_tol_ = tol_;
+    // If only products with the Hessian are available, its diagonal
+    // cannot be used for the preconditioner
+    options.GetBoolValue("hessian_vector_products", w_products_only_, prefix);
+
+    // The structure is set up again during the first solve
+    aug_vector_space_ = NULL;
+    w_tag_ = 0;
+    j_c_tag_ = 0;
+    j_d_tag_ = 0;
+
+    return true;
+  }
+
+  ESymSolverStatus KrylovAugSystemSolver::MultiSolve(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix* J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix* J_d,
+    const Vector* D_d,
+    double delta_d,
+    std::vector<SmartPtr<const Vector> >& rhs_xV,
+    std::vector<SmartPtr<const Vector> >& rhs_sV,
+    std::vector<SmartPtr<const Vector> >& rhs_cV,
+    std::vector<SmartPtr<const Vector> >& rhs_dV,
+    std::vector<SmartPtr<Vector> >& sol_xV,
+    std::vector<SmartPtr<Vector> >& sol_sV,
+    std::vector<SmartPtr<Vector> >& sol_cV,
+    std::vector<SmartPtr<Vector> >& sol_dV,
+    bool check_NegEVals,
+    Index numberOfNegEVals)
+  {
+    DBG_START_METH("KrylovAugSystemSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(J_c && J_d && "Currently, you MUST specify J_c and J_d in the augmented system");
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().Start();
+
+    if (IsNull(aug_vector_space_)) {
+      DBG_ASSERT(W && "W must be given during the first call to set up the structure");
+      InitializeStructure(*W, *J_c, *J_d, *rhs_xV[0], *rhs_sV[0],
+                          *rhs_cV[0], *rhs_dV[0]);
+    }
+
+    if (AugmentedSystemRequiresChange(W, W_factor, D_x, delta_x, D_s, delta_s,
+                                      *J_c, D_c, delta_c, *J_d, D_d, delta_d)) {
+      ComputePreconditioner(W, W_factor, D_x, delta_x, D_s, delta_s,
+                            *J_c, D_c, delta_c, *J_d, D_d, delta_d);
+      // A tightened tolerance only applies to the matrix for which
+      // IncreaseQuality was called; start again from krylov_tol
+      curr_tol_ = tol_;
+    }
+
+    IpData().TimingStats().LinearSystemBackSolve().Start();
+    SmartPtr<CompoundVector> rhs = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> sol = aug_vector_space_->MakeNewCompoundVector();
+    ESymSolverStatus retval = SYMSOLVER_SUCCESS;
+    for (Index i=0; i<(Index)rhs_xV.size(); i++) {
+      rhs->GetCompNonConst(0)->Copy(*rhs_xV[i]);
+      rhs->GetCompNonConst(1)->Copy(*rhs_sV[i]);
+      rhs->GetCompNonConst(2)->Copy(*rhs_cV[i]);
+      rhs->GetCompNonConst(3)->Copy(*rhs_dV[i]);
+      if (!Minres(W, W_factor, *J_c, *J_d, *rhs, *sol)) {
+        retval = SYMSOLVER_SINGULAR;
+        break;
+      }
+      sol_xV[i]->Copy(*sol->GetComp(0));
+      sol_sV[i]->Copy(*sol->GetComp(1));
+      sol_cV[i]->Copy(*sol->GetComp(2));
+      sol_dV[i]->Copy(*sol->GetComp(3));
+    }
+    IpData().TimingStats().LinearSystemBackSolve().End();
+
+    IpData().TimingStats().StdAugSystemSolverMultiSolve().End();
+    return retval;
+  }
+
+  void KrylovAugSystemSolver::InitializeStructure(const SymMatrix& W,
+      const Matrix& J_c,
+      const Matrix& J_d,
+      const Vector& proto_x,
+      const Vector& proto_s,
+      const Vector& proto_c,
+      const Vector& proto_d)
+  {
+    DBG_START_METH("KrylovAugSystemSolver::InitializeStructure",
+                   dbg_verbosity);
+
+    n_x_ = proto_x.Dim();
+    n_c_ = proto_c.Dim();
+    n_d_ = proto_d.Dim();
+    DBG_ASSERT(proto_s.Dim() == n_d_);
+
+    aug_vector_space_ = new CompoundVectorSpace(4, n_x_ + 2*n_d_ + n_c_);
+    aug_vector_space_->SetCompSpace(0, *proto_x.OwnerSpace());
+    aug_vector_space_->SetCompSpace(1, *proto_s.OwnerSpace());
+    aug_vector_space_->SetCompSpace(2, *proto_c.OwnerSpace());
+    aug_vector_space_->SetCompSpace(3, *proto_d.OwnerSpace());
+
+    nnz_w_ = w_products_only_ ? 0 : TripletHelper::GetNumberEntries(W);
+    nnz_jac_c_ = TripletHelper::GetNumberEntries(J_c);
+    nnz_jac_d_ = TripletHelper::GetNumberEntries(J_d);
+    const Index nnz = nnz_w_ + nnz_jac_c_ + nnz_jac_d_;
+
+    irow_.resize(nnz + 1);
+    jcol_.resize(nnz + 1);
+    if (!w_products_only_) {
+      TripletHelper::FillRowCol(nnz_w_, W, &irow_[0], &jcol_[0]);
+    }
+    TripletHelper::FillRowCol(nnz_jac_c_, J_c, &irow_[nnz_w_],
+                              &jcol_[nnz_w_]);
+    TripletHelper::FillRowCol(nnz_jac_d_, J_d, &irow_[nnz_w_ + nnz_jac_c_],
+                              &jcol_[nnz_w_ + nnz_jac_c_]);
+    for (Index e=0; e<nnz; e++) {
+      irow_[e]--;
+      jcol_[e]--;
+    }
+    vals_.resize(nnz + 1);
+
+    diag_ = aug_vector_space_->MakeNewCompoundVector();
+    inv_precond_ = aug_vector_space_->MakeNewCompoundVector();
+  }
+
+  void KrylovAugSystemSolver::ComputePreconditioner(const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix& J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix& J_d,
+      const Vector* D_d,
+      double delta_d)
+  {
+    DBG_START_METH("KrylovAugSystemSolver::ComputePreconditioner",
+                   dbg_verbosity);
+
+    // Diagonals of the augmented system without W
+    SmartPtr<Vector> diag_x = diag_->GetCompNonConst(0);
+    SmartPtr<Vector> diag_s = diag_->GetCompNonConst(1);
+    SmartPtr<Vector> diag_c = diag_->GetCompNonConst(2);
+    SmartPtr<Vector> diag_d = diag_->GetCompNonConst(3);
+    if (D_x) {
+      diag_x->Copy(*D_x);
+      diag_x->AddScalar(delta_x);
+    }
+    else {
+      diag_x->Set(delta_x);
+    }
+    if (D_s) {
+      diag_s->Copy(*D_s);
+      diag_s->AddScalar(delta_s);
+    }
+    else {
+      diag_s->Set(delta_s);
+    }
+    if (D_c) {
+      diag_c->Copy(*D_c);
+      diag_c->AddScalar(-delta_c);
+    }
+    else {
+      diag_c->Set(-delta_c);
+    }
+    if (D_d) {
+      diag_d->Copy(*D_d);
+      diag_d->AddScalar(-delta_d);
+    }
+    else {
+      diag_d->Set(-delta_d);
+    }
+
+    // Lower bound for the diagonal elements of the preconditioner
+    const Number min_diag = 1e-8;
+
+    std::vector<Number> p_x(n_x_ + 1);
+    std::vector<Number> p_s(n_d_ + 1);
+    std::vector<Number> p_c(n_c_ + 1);
+    std::vector<Number> p_d(n_d_ + 1);
+    TripletHelper::FillValuesFromVector(n_x_, *diag_x, &p_x[0]);
+    TripletHelper::FillValuesFromVector(n_d_, *diag_s, &p_s[0]);
+    TripletHelper::FillValuesFromVector(n_c_, *diag_c, &p_c[0]);
+    TripletHelper::FillValuesFromVector(n_d_, *diag_d, &p_d[0]);
+
+    if (W && W_factor != 0. && !w_products_only_) {
+      TripletHelper::FillValues(nnz_w_, *W, &vals_[0]);
+      for (Index e=0; e<nnz_w_; e++) {
+        if (irow_[e] == jcol_[e]) {
+          p_x[irow_[e]] += W_factor*vals_[e];
+        }
+      }
+    }
+    for (Index i=0; i<n_x_; i++) {
+      p_x[i] = Max(fabs(p_x[i]), min_diag);
+    }
+    for (Index i=0; i<n_d_; i++) {
+      p_s[i] = Max(fabs(p_s[i]), min_diag);
+      p_d[i] = fabs(p_d[i]) + 1./p_s[i];
+    }
+    for (Index i=0; i<n_c_; i++) {
+      p_c[i] = fabs(p_c[i]);
+    }
+
+    TripletHelper::FillValues(nnz_jac_c_, J_c, &vals_[nnz_w_]);
+    TripletHelper::FillValues(nnz_jac_d_, J_d, &vals_[nnz_w_ + nnz_jac_c_]);
+    for (Index e=nnz_w_; e<nnz_w_ + nnz_jac_c_; e++) {
+      p_c[irow_[e]] += vals_[e]*vals_[e]/p_x[jcol_[e]];
+    }
+    for (Index e=nnz_w_ + nnz_jac_c_; e<nnz_w_ + nnz_jac_c_ + nnz_jac_d_; e++) {
+      p_d[irow_[e]] += vals_[e]*vals_[e]/p_x[jcol_[e]];
+    }
+    for (Index i=0; i<n_c_; i++) {
+      p_c[i] = Max(p_c[i], min_diag);
+    }
+    for (Index i=0; i<n_d_; i++) {
+      p_d[i] = Max(p_d[i], min_diag);
+    }
+
+    TripletHelper::PutValuesInVector(n_x_, &p_x[0],
+                                     *inv_precond_->GetCompNonConst(0));
+    TripletHelper::PutValuesInVector(n_d_, &p_s[0],
+                                     *inv_precond_->GetCompNonConst(1));
+    TripletHelper::PutValuesInVector(n_c_, &p_c[0],
+                                     *inv_precond_->GetCompNonConst(2));
+    TripletHelper::PutValuesInVector(n_d_, &p_d[0],
+                                     *inv_precond_->GetCompNonConst(3));
+    inv_precond_->ElementWiseReciprocal();
+
+    // Remember the tags and values of this system
+    w_tag_ = W ? W->GetTag() : 0;
+    w_factor_ = W_factor;
+    d_x_tag_ = D_x ? D_x->GetTag() : 0;
+    delta_x_ = delta_x;
+    d_s_tag_ = D_s ? D_s->GetTag() : 0;
+    delta_s_ = delta_s;
+    j_c_tag_ = J_c.GetTag();
+    d_c_tag_ = D_c ? D_c->GetTag() : 0;
+    delta_c_ = delta_c;
+    j_d_tag_ = J_d.GetTag();
+    d_d_tag_ = D_d ? D_d->GetTag() : 0;
+    delta_d_ = delta_d;
+  }
+
+  void KrylovAugSystemSolver::MultAugSystem(const SymMatrix* W,
+      double W_factor,
+      const Matrix& J_c,
+      const Matrix& J_d,
+      const CompoundVector& v,
+      CompoundVector& result) const
+  {
+    SmartPtr<const Vector> v_x = v.GetComp(0);
+    SmartPtr<const Vector> v_s = v.GetComp(1);
+    SmartPtr<const Vector> v_c = v.GetComp(2);
+    SmartPtr<const Vector> v_d = v.GetComp(3);
+    SmartPtr<Vector> r_x = result.GetCompNonConst(0);
+    SmartPtr<Vector> r_s = result.GetCompNonConst(1);
+    SmartPtr<Vector> r_c = result.GetCompNonConst(2);
+    SmartPtr<Vector> r_d = result.GetCompNonConst(3);
+
+    // diagonal part
+    result.Copy(v);
+    result.ElementWiseMultiply(*diag_);
+
+    if (W && W_factor != 0.) {
+      W->MultVector(W_factor, *v_x, 1., *r_x);
+    }
+    J_c.TransMultVector(1., *v_c, 1., *r_x);
+    J_d.TransMultVector(1., *v_d, 1., *r_x);
+    r_s->Axpy(-1., *v_d);
+    J_c.MultVector(1., *v_x, 1., *r_c);
+    J_d.MultVector(1., *v_x, 1., *r_d);
+    r_d->Axpy(-1., *v_s);
+  }
+
+  bool KrylovAugSystemSolver::Minres(const SymMatrix* W,
+                                     double W_factor,
+                                     const Matrix& J_c,
+                                     const Matrix& J_d,
+                                     const CompoundVector& rhs,
+                                     CompoundVector& sol)
+  {
+    DBG_START_METH("KrylovAugSystemSolver::Minres", dbg_verbosity);
+
+    // Preconditioned MINRES following Paige and Saunders
+    sol.Set(0.);
+
+    SmartPtr<CompoundVector> r1 = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> r2 = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> y = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> v = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> w = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> w1 = aug_vector_space_->MakeNewCompoundVector();
+    SmartPtr<CompoundVector> w2 = aug_vector_space_->MakeNewCompoundVector();
+
+    r1->Copy(rhs);
+    y->Copy(rhs);
+    y->ElementWiseMultiply(*inv_precond_);
+    Number beta1 = r1->Dot(*y);
+    if (beta1 <= 0.) {
+      // zero right hand side
+      return true;
+    }
+    beta1 = sqrt(beta1);
+    r2->Copy(*r1);
+    w->Set(0.);
+    w2->Set(0.);
+
+    Number oldb = 0.;
+    Number beta = beta1;
+    Number dbar = 0.;
+    Number epsln = 0.;
+    Number phibar = beta1;
+    Number cs = -1.;
+    Number sn = 0.;
+
+    Index iter;
+    for (iter=1; iter<=max_iter_; iter++) {
+      v->Copy(*y);
+      v->Scal(1./beta);
+
+      MultAugSystem(W, W_factor, J_c, J_d, *v, *y);
+      if (iter >= 2) {
+        y->Axpy(-beta/oldb, *r1);
+      }
+      Number alfa = v->Dot(*y);
+      y->Axpy(-alfa/beta, *r2);
+      std::swap(r1, r2);
+      r2->Copy(*y);
+      y->ElementWiseMultiply(*inv_precond_);
+      oldb = beta;
+      beta = r2->Dot(*y);
+      if (beta < 0.) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "MINRES breakdown in iteration %d.\n", iter);
+        return false;
+      }
+      beta = sqrt(beta);
+
+      Number oldeps = epsln;
+      Number delta = cs*dbar + sn*alfa;
+      Number gbar = sn*dbar - cs*alfa;
+      epsln = sn*beta;
+      dbar = -cs*beta;
+      Number gamma = sqrt(gbar*gbar + beta*beta);
+      if (gamma == 0.) {
+        Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                       "MINRES breakdown in iteration %d.\n", iter);
+        return false;
+      }
+      cs = gbar/gamma;
+      sn = beta/gamma;
+      Number phi = cs*phibar;
+      phibar = sn*phibar;
+
+      // w = (v - oldeps*w1 - delta*w2)/gamma with w1 <- w2 <- w
+      std::swap(w1, w2);
+      std::swap(w2, w);
+      w->AddTwoVectors(-oldeps/gamma, *w1, -delta/gamma, *w2, 0.);
+      w->Axpy(1./gamma, *v);
+      sol.Axpy(phi, *w);
+
+      if (phibar <= curr_tol_*beta1 || beta == 0.) {
+        break;
+      }
+    }
+
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "MINRES: %d iterations, relative residual %e.\n",
+                   Min(iter, max_iter_), phibar/beta1);
+    if (iter > max_iter_) {
+      Jnlst().Printf(J_WARNING, J_LINEAR_ALGEBRA,
+                     "MINRES did not converge within %d iterations (relative residual %e).\n",
+                     max_iter_, phibar/beta1);
+    }
+    return true;
+  }
+
+  bool KrylovAugSystemSolver::AugmentedSystemRequiresChange(
+    const SymMatrix* W,
+    double W_factor,
+    const Vector* D_x,
+    double delta_x,
+    const Vector* D_s,
+    double delta_s,
+    const Matrix& J_c,
+    const Vector* D_c,
+    double delta_c,
+    const Matrix& J_d,
+    const Vector* D_d,
+    double delta_d)
+  {
+    if ( (W && W->GetTag() != w_tag_)
+         || (!W && w_tag_ != 0)
+         || (W_factor != w_factor_)
+         || (D_x && D_x->GetTag() != d_x_tag_)
+         || (!D_x && d_x_tag_ != 0)
+         || (delta_x != delta_x_)
+         || (D_s && D_s->GetTag() != d_s_tag_)
+         || (!D_s && d_s_tag_ != 0)
+         || (delta_s != delta_s_)
+         || (J_c.GetTag() != j_c_tag_)
+         || (D_c && D_c->GetTag() != d_c_tag_)
+         || (!D_c && d_c_tag_ != 0)
+         || (delta_c != delta_c_)
+         || (J_d.GetTag() != j_d_tag_)
+         || (D_d && D_d->GetTag() != d_d_tag_)
+         || (!D_d && d_d_tag_ != 0)
+         || (delta_d != delta_d_) ) {
+      return true;
+    }
+
+    return false;
+  }
+
+  Index KrylovAugSystemSolver::NumberOfNegEVals() const
+  {
+    // The inertia is not known
+    return -1;
+  }
+
+  bool KrylovAugSystemSolver::IncreaseQuality()
+  {
+    if (curr_tol_ <= min_tol_) {
+      return false;
+    }
+    curr_tol_ = Max(1e-2*curr_tol_, min_tol_);
+    Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                   "Decreasing MINRES tolerance to %e.\n", curr_tol_);
+    return true;
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,261 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IP_KRYLOVAUGSYSTEMSOLVER_HPP__
+#define __IP_KRYLOVAUGSYSTEMSOLVER_HPP__
+
+#include "IpAugSystemSolver.hpp"
+#include "IpCompoundVector.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** Solver for the augmented system based on the preconditioned
+   *  MINRES method.  The augmented system is never formed
+   *  explicitly; the method only requires products with the
+   *  Hessian and the Jacobians, so that no factorization has to be
+   *  stored.
+   *
+   *  The preconditioner is the positive definite block diagonal
+   *  matrix
+   *
+   *  \f$P = \mbox{diag}(|\mbox{diag}(W) + D_x + \delta_x I|,\;
+   *                      |D_s + \delta_s I|,\;
+   *                      \mbox{diag}(J_c P_x^{-1} J_c^T) + |D_c - \delta_c I|,\;
+   *                      \mbox{diag}(J_d P_x^{-1} J_d^T) + P_s^{-1} + |D_d - \delta_d I|)\f$,
+   *
+   *  i.e., the diagonal of the (1,1) block together with an
+   *  approximation of the diagonal of the Schur complement for the
+   *  constraints.  If the Hessian is only available through products
+   *  (option hessian_vector_products), diag(W) is omitted.
+   *
+   *  The solution is computed only up to the relative tolerance
+   *  krylov_tol.  The residual test and the iterative refinement in
+   *  the PDFullSpaceSolver decide whether the step is accurate
+   *  enough; if not, IncreaseQuality tightens the tolerance for the
+   *  current matrix.  The tolerance is reset to krylov_tol whenever
+   *  the augmented system changes, so that the iterations for later
+   *  systems are not spent on accuracy that is not needed.  Since
+   *  no factorization is computed, this solver does not provide the
+   *  inertia of the augmented system; check_NegEVals is ignored, and
+   *  the PDFullSpaceSolver tests the curvature of each step instead
+   *  (see neg_curv_test_tol).
+   */
+  class KrylovAugSystemSolver : public AugSystemSolver
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Default constructor */
+    KrylovAugSystemSolver();
+
+    /** Default destructor */
+    virtual ~KrylovAugSystemSolver();
+    //@}
+
+    /** overloaded from AlgorithmStrategyObject */
+    bool InitializeImpl(const OptionsList& options,
+                        const std::string& prefix);
+
+    /** Solve the augmented system for a set of given right hand
+     *  sides, one after the other. */
+    virtual ESymSolverStatus MultiSolve(
+      const SymMatrix* W,
+      double W_factor,
+      const Vector* D_x,
+      double delta_x,
+      const Vector* D_s,
+      double delta_s,
+      const Matrix* J_c,
+      const Vector* D_c,
+      double delta_c,
+      const Matrix* J_d,
+      const Vector* D_d,
+      double delta_d,
+      std::vector<SmartPtr<const Vector> >& rhs_xV,
+      std::vector<SmartPtr<const Vector> >& rhs_sV,
+      std::vector<SmartPtr<const Vector> >& rhs_cV,
+      std::vector<SmartPtr<const Vector> >& rhs_dV,
+      std::vector<SmartPtr<Vector> >& sol_xV,
+      std::vector<SmartPtr<Vector> >& sol_sV,
+      std::vector<SmartPtr<Vector> >& sol_cV,
+      std::vector<SmartPtr<Vector> >& sol_dV,
+      bool check_NegEVals,
+      Index numberOfNegEVals);
+
+    /** Number of negative eigenvalues detected during last solve.
+     *  This is not available for this solver, so that -1 is
+     *  returned. */
+    virtual Index NumberOfNegEVals() const;
+
+    /** Query whether inertia is computed by linear solver.  Always
+     *  false for this solver. */
+    virtual bool ProvidesInertia() const
+    {
+      return false;
+    }
+
+    /** Request to increase quality of solution for next solve.  The
+     *  tolerance of the MINRES method is decreased, unless it has
+     *  already reached its lower limit. */
+    virtual bool IncreaseQuality();
+
+    /** Methods for IpoptType */
+    //@{
+    static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Copy Constructor */
+    KrylovAugSystemSolver(const KrylovAugSystemSolver&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const KrylovAugSystemSolver&);
+    //@}
+
+    /** Set up the vector space for the augmented system and store
+     *  the sparsity structure required for the preconditioner. */
+    void InitializeStructure(const SymMatrix& W,
+                             const Matrix& J_c,
+                             const Matrix& J_d,
+                             const Vector& proto_x,
+                             const Vector& proto_s,
+                             const Vector& proto_c,
+                             const Vector& proto_d);
+
+    /** Compute the diagonals of the augmented system and the inverse
+     *  of the preconditioner. */
+    void ComputePreconditioner(const SymMatrix* W,
+                               double W_factor,
+                               const Vector* D_x,
+                               double delta_x,
+                               const Vector* D_s,
+                               double delta_s,
+                               const Matrix& J_c,
+                               const Vector* D_c,
+                               double delta_c,
+                               const Matrix& J_d,
+                               const Vector* D_d,
+                               double delta_d);
+
+    /** Compute the product of the augmented system with v. */
+    void MultAugSystem(const SymMatrix* W,
+                       double W_factor,
+                       const Matrix& J_c,
+                       const Matrix& J_d,
+                       const CompoundVector& v,
+                       CompoundVector& result) const;
+
+    /** Solve the augmented system for one right hand side with
+     *  preconditioned MINRES.  Returns false if the method broke
+     *  down. */
+    bool Minres(const SymMatrix* W,
+                double W_factor,
+                const Matrix& J_c,
+                const Matrix& J_d,
+                const CompoundVector& rhs,
+                CompoundVector& sol);
+
+    /** Check the internal tags and decide if the passed variables are
+     *  different from those for which the preconditioner has been
+     *  computed most recently. */
+    bool AugmentedSystemRequiresChange(const SymMatrix* W,
+                                       double W_factor,
+                                       const Vector* D_x,
+                                       double delta_x,
+                                       const Vector* D_s,
+                                       double delta_s,
+                                       const Matrix& J_c,
+                                       const Vector* D_c,
+                                       double delta_c,
+                                       const Matrix& J_d,
+                                       const Vector* D_d,
+                                       double delta_d);
+
+    /** Vector space for the unknowns of the augmented system */
+    SmartPtr<CompoundVectorSpace> aug_vector_space_;
+
+    /** @name Structure of the matrices */
+    //@{
+    /** Dimensions of the parts of the augmented system */
+    Index n_x_;
+    Index n_c_;
+    Index n_d_;
+    /** Number of elements of W (zero if only products with W are
+     *  available) */
+    Index nnz_w_;
+    /** Number of elements of J_c */
+    Index nnz_jac_c_;
+    /** Number of elements of J_d */
+    Index nnz_jac_d_;
+    /** Row and column indices (starting at 0) of the elements of W,
+     *  J_c and J_d (in this order) */
+    std::vector<Index> irow_;
+    std::vector<Index> jcol_;
+    //@}
+
+    /** @name Diagonals of the augmented system and preconditioner */
+    //@{
+    /** Diagonal of the augmented system without the contribution of
+     *  W, i.e., D_x + delta_x I, D_s + delta_s I, D_c - delta_c I,
+     *  and D_d - delta_d I */
+    SmartPtr<CompoundVector> diag_;
+    /** Inverse of the diagonal preconditioner */
+    SmartPtr<CompoundVector> inv_precond_;
+    /** Work space for the values of matrix elements */
+    std::vector<Number> vals_;
+    //@}
+
+    /**@name Tags and values to track in order to decide whether the
+       preconditioner has to be updated compared to the most recent
+       call of the Set method.
+     */
+    //@{
+    TaggedObject::Tag w_tag_;
+    double w_factor_;
+    TaggedObject::Tag d_x_tag_;
+    double delta_x_;
+    TaggedObject::Tag d_s_tag_;
+    double delta_s_;
+    TaggedObject::Tag j_c_tag_;
+    TaggedObject::Tag d_c_tag_;
+    double delta_c_;
+    TaggedObject::Tag j_d_tag_;
+    TaggedObject::Tag d_d_tag_;
+    double delta_d_;
+    //@}
+
+    /** @name Algorithmic parameters */
+    //@{
+    /** Maximal number of MINRES iterations */
+    Index max_iter_;
+    /** Relative tolerance for the preconditioned residual */
+    Number tol_;
+    /** Lower limit for the tolerance when the quality is
+     *  increased */
+    Number min_tol_;
+    /** Flag indicating that W is only available through products */
+    bool w_products_only_;
+    //@}
+
+    /** Current tolerance (decreased by IncreaseQuality, reset for
+     *  each new matrix) */
+    Number curr_tol_;
+  };
+
+} // namespace Ipopt
+
+#endif
@@ -284,6 +284,19 @@ namespace Ipopt
     return retval;
   }
 
+  bool
+  NLPBoundsRemover::Eval_h_prod(const Vector& x, Number obj_factor,
+                                const Vector& yc, const Vector& yd,
+                                const Vector& v, Vector& h_v)
+  {
+    const CompoundVector* comp_yd = static_cast<const CompoundVector*>(&yd);
+    DBG_ASSERT(dynamic_cast<const CompoundVector*>(&yd));
+    SmartPtr<const Vector> yd_orig = comp_yd->GetComp(0);
+
+    bool retval = nlp_->Eval_h_prod(x, obj_factor, yc, *yd_orig, v, h_v);
+    return retval;
+  }
+
   void
   NLPBoundsRemover::FinalizeSolution(SolverReturn status,
                                      const Vector& x, const Vector& z_L,
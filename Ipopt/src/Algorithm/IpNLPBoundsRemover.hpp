@@ -129,6 +129,13 @@ namespace Ipopt
                         const Vector& yc,
                         const Vector& yd,
                         SymMatrix& h);
+
+    virtual bool Eval_h_prod(const Vector& x,
+                             Number obj_factor,
+                             const Vector& yc,
+                             const Vector& yd,
+                             const Vector& v,
+                             Vector& h_v);
     //@}
 
     /** @name NLP solution routines. Have default dummy
@@ -45,6 +45,18 @@ namespace Ipopt
       "A limit on CPU seconds that Ipopt can use to solve one problem.  If "
       "during the convergence check this limit is exceeded, Ipopt will "
       "terminate with a corresponding error message.");
+    roptions->AddLowerBoundedNumberOption(
+      "max_wall_time",
+      "Maximum number of wallclock seconds.",
+      0.0, true, 1e20,
+      "A limit on the wallclock time that Ipopt can use to solve one "
+      "problem.  The limit is checked in every iteration, during the "
+      "backtracking line search, and in the restoration phase.  If it is "
+      "exceeded, Ipopt terminates with a corresponding error message and "
+      "returns the best iterate encountered so far: among the iterates "
+      "that satisfy \"constr_viol_tol\" the one with the smallest objective "
+      "function value, or, if there is no such iterate, the one with the "
+      "smallest constraint violation.");
     roptions->AddLowerBoundedNumberOption(
       "dual_inf_tol",
       "Desired threshold for the dual infeasibility.",
@@ -259,6 +271,10 @@ namespace Ipopt
       return ConvergenceCheck::CPUTIME_EXCEEDED;
     }
 
+    if (IpData().WallclockTimeExceeded()) {
+      return ConvergenceCheck::WALLTIME_EXCEEDED;
+    }
+
     return ConvergenceCheck::CONTINUE;
   }
 
@@ -8,6 +8,7 @@
 
 #include "IpOrigIpoptNLP.hpp"
 #include "IpLowRankUpdateSymMatrix.hpp"
+#include "IpHessianProductMatrix.hpp"
 #include "IpIpoptData.hpp"
 #include "IpIpoptCalculatedQuantities.hpp"
 
@@ -136,6 +137,19 @@ namespace Ipopt
       "nonlinear-variables",
       "nonlinear-variables", "only in space of nonlinear variables.",
       "all-variables", "in space of all variables (without slacks)");
+    roptions->AddStringOption2(
+      "hessian_vector_products",
+      "Indicates whether the exact Hessian is only used through products with vectors.",
+      "no",
+      "no", "Obtain the Hessian of the Lagrangian from eval_h.",
+      "yes", "Only compute products with the Hessian by eval_h_prod.",
+      "If this option is set to yes, the elements of the Hessian of the "
+      "Lagrangian function are never requested from the NLP.  Instead, the "
+      "algorithm uses the method eval_h_prod of the TNLP to compute products "
+      "of the Hessian with vectors.  This is only possible if the augmented "
+      "system is solved without factorization, i.e., with "
+      "aug_system_solver=krylov.  This option is ignored unless "
+      "hessian_approximation is exact.");
   }
 
   bool OrigIpoptNLP::Initialize(const Journalist& jnlst,
@@ -154,6 +168,11 @@ namespace Ipopt
     hessian_approximation_ = HessianApproximationType(enum_int);
     options.GetEnumValue("hessian_approximation_space", enum_int, prefix);
     hessian_approximation_space_ = HessianApproximationSpace(enum_int);
+    options.GetBoolValue("hessian_vector_products",
+                         hessian_vector_products_, prefix);
+    if (hessian_approximation_!=EXACT) {
+      hessian_vector_products_ = false;
+    }
 
     options.GetBoolValue("jac_c_constant", jac_c_constant_, prefix);
     options.GetBoolValue("jac_d_constant", jac_d_constant_, prefix);
@@ -280,6 +299,9 @@ namespace Ipopt
                          x_space_->Dim());
         }
       }
+      else if (hessian_vector_products_) {
+        h_space_ = new HessianProductMatrixSpace(x_space_->Dim());
+      }
 
       // Create the bounds structures
       x_L = x_l_space_->MakeNew();
@@ -735,13 +757,25 @@ namespace Ipopt
     scalar_deps[0] = obj_factor;
 
     if (!h_cache_.GetCachedResult(retValue, deps, scalar_deps)) {
-      h_evals_++;
-      unscaled_h = h_space_->MakeNewSymMatrix();
-
       SmartPtr<const Vector> unscaled_x = get_unscaled_x(x);
       SmartPtr<const Vector> unscaled_yc = NLP_scaling()->apply_vector_scaling_c(&yc);
       SmartPtr<const Vector> unscaled_yd = NLP_scaling()->apply_vector_scaling_d(&yd);
       Number scaled_obj_factor = NLP_scaling()->apply_obj_scaling(obj_factor);
+
+      if (hessian_vector_products_) {
+        // The Hessian is not evaluated here; the matrix only remembers
+        // the point, and the products are computed by the NLP
+        HessianProductMatrix* prod_h =
+          static_cast<const HessianProductMatrixSpace*>(GetRawPtr(h_space_))->MakeNewHessianProductMatrix();
+        prod_h->SetPoint(nlp_, unscaled_x, scaled_obj_factor, unscaled_yc, unscaled_yd);
+        unscaled_h = prod_h;
+        retValue = NLP_scaling()->apply_hessian_scaling(ConstPtr(unscaled_h));
+        h_cache_.AddCachedResult(retValue, deps, scalar_deps);
+        return retValue;
+      }
+
+      h_evals_++;
+      unscaled_h = h_space_->MakeNewSymMatrix();
       h_eval_time_.Start();
       bool success = nlp_->Eval_h(*unscaled_x, scaled_obj_factor, *unscaled_yc, *unscaled_yd, *unscaled_h);
       h_eval_time_.End();
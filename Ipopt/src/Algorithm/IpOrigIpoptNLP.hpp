@@ -444,6 +444,9 @@ namespace Ipopt
     HessianApproximationType hessian_approximation_;
     /** Flag indicating in which space Hessian is to be approximated. */
     HessianApproximationSpace hessian_approximation_space_;
+    /** Flag indicating whether the exact Hessian is only used
+     *  through products computed by the NLP. */
+    bool hessian_vector_products_;
     /** Flag indicating whether it is desired to check if there are
      *  Nan or Inf entries in first and second derivative matrices. */
     bool check_derivatives_for_naninf_;
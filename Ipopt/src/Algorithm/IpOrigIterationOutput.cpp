@@ -18,6 +18,16 @@
 # endif
 #endif
 
+#ifdef HAVE_CSTRING
+# include <cstring>
+#else
+# ifdef HAVE_STRING_H
+#  include <string.h>
+# else
+#  error "don't have header file for string"
+# endif
+#endif
+
 #ifdef HAVE_CSTDIO
 # include <cstdio>
 #else
@@ -30,11 +40,32 @@
 
 namespace Ipopt
 {
+  /** Names of the fields of a record in the iteration trace */
+  static const char* trace_fields[] = {
+    "iter", "objective", "inf_pr", "inf_du", "mu", "d_norm", "delta_x",
+    "alpha_du", "alpha_pr", "alpha_pr_type", "ls_trials",
+    "inertia_corrections", "wall_time", "time_update_hessian",
+    "time_search_direction", "time_line_search", "time_update_barrier",
+    "time_check_convergence", "time_factorization", "time_backsolve"
+  };
+  static const Index n_trace_fields =
+    sizeof(trace_fields)/sizeof(trace_fields[0]);
+  /** Position of alpha_pr_type, which is written as a string in the
+   *  JSON Lines format */
+  static const Index trace_alpha_pr_type_pos = 9;
+
   OrigIterationOutput::OrigIterationOutput()
+      :
+      trace_file_(NULL),
+      trace_binary_(false)
   {}
 
   OrigIterationOutput::~OrigIterationOutput()
-  {}
+  {
+    if (trace_file_) {
+      fclose(trace_file_);
+    }
+  }
 
   void
   OrigIterationOutput::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
@@ -75,6 +106,33 @@ namespace Ipopt
        0.0,
        "Summarizing iteration output is printed if at least print_frequency_time seconds have "
        "passed since last output and the iteration number is a multiple of print_frequency_iter.");
+    roptions->AddStringOption1(
+      "iteration_trace_file",
+      "File name for a machine-readable trace of the iterations (leave unset for no trace).",
+      "",
+      "*", "Any acceptable standard file name",
+      "If set, one record per iteration is written to this file, independent "
+      "of the print level.  A record contains the values of the iteration "
+      "summary line (objective, inf_pr, inf_du, mu, ||d||, regularization, "
+      "step sizes, line search trials), the number of inertia corrections, "
+      "the wallclock time since the start of the optimization, and the "
+      "accumulated wallclock times of the main parts of the algorithm.  "
+      "Iterations in the restoration phase are not recorded individually.  "
+      "The file is overwritten at the beginning of each optimization.");
+    roptions->AddStringOption2(
+      "iteration_trace_format",
+      "Format of the iteration trace file.",
+      "jsonl",
+      "jsonl", "one JSON object per line",
+      "binary", "compact binary records",
+      "In the binary format, the file starts with the 8 characters "
+      "\"IPOPTTRC\", followed by the format version and the number of "
+      "fields as integers and the zero-terminated field names.  Each record "
+      "then consists of one double precision number per field.  Integers and "
+      "doubles are written in the native byte order.  In both formats, "
+      "the type of the primal step (alpha_pr_type) is the character "
+      "printed after alpha_pr in the iteration output (as its character "
+      "code in the binary format).");
     roptions->SetRegisteringCategory(prev_cat);
   }
 
@@ -88,9 +146,69 @@ namespace Ipopt
     options.GetIntegerValue("print_frequency_iter", print_frequency_iter_, prefix);
     options.GetNumericValue("print_frequency_time", print_frequency_time_, prefix);
 
+    if (trace_file_) {
+      fclose(trace_file_);
+      trace_file_ = NULL;
+    }
+    std::string trace_file_name;
+    options.GetStringValue("iteration_trace_file", trace_file_name, prefix);
+    if (trace_file_name != "") {
+      options.GetEnumValue("iteration_trace_format", enum_int, prefix);
+      trace_binary_ = (enum_int == 1);
+      ASSERT_EXCEPTION(OpenTraceFile(trace_file_name), OPTION_INVALID,
+                       "Could not open the file given by iteration_trace_file.");
+    }
+
+    return true;
+  }
+
+  bool OrigIterationOutput::OpenTraceFile(const std::string& fname)
+  {
+    trace_file_ = fopen(fname.c_str(), trace_binary_ ? "wb" : "w");
+    if (!trace_file_) {
+      return false;
+    }
+    if (trace_binary_) {
+      const Index version = 1;
+      fwrite("IPOPTTRC", 1, 8, trace_file_);
+      fwrite(&version, sizeof(Index), 1, trace_file_);
+      fwrite(&n_trace_fields, sizeof(Index), 1, trace_file_);
+      for (Index i=0; i<n_trace_fields; i++) {
+        fwrite(trace_fields[i], 1, strlen(trace_fields[i]) + 1, trace_file_);
+      }
+      fflush(trace_file_);
+    }
     return true;
   }
 
+  void OrigIterationOutput::WriteTraceRecord(const Number* values,
+      char alpha_primal_char)
+  {
+    if (trace_binary_) {
+      fwrite(values, sizeof(Number), n_trace_fields, trace_file_);
+    }
+    else {
+      fputc('{', trace_file_);
+      for (Index i=0; i<n_trace_fields; i++) {
+        fprintf(trace_file_, "%s\"%s\":", i>0 ? "," : "", trace_fields[i]);
+        if (i == trace_alpha_pr_type_pos) {
+          fprintf(trace_file_, "\"%c\"", alpha_primal_char);
+        }
+        else if (IsFiniteNumber(values[i])) {
+          fprintf(trace_file_, "%.17g", values[i]);
+        }
+        else {
+          // JSON has no representation of inf and nan
+          fputs("null", trace_file_);
+        }
+      }
+      fputs("}\n", trace_file_);
+    }
+    // Flush after every record, so that the trace is complete up to
+    // the last iteration also if the optimization is interrupted
+    fflush(trace_file_);
+  }
+
   void OrigIterationOutput::WriteOutput()
   {
     //////////////////////////////////////////////////////////////////////
@@ -177,6 +295,32 @@ namespace Ipopt
       IpData().Inc_info_iters_since_header();
     }
 
+    if (trace_file_) {
+      TimingStatistics& timing = IpData().TimingStats();
+      Number values[n_trace_fields];
+      values[0] = (Number)iter;
+      values[1] = unscaled_f;
+      values[2] = inf_pr;
+      values[3] = inf_du;
+      values[4] = mu;
+      values[5] = dnrm;
+      values[6] = regu_x;
+      values[7] = alpha_dual;
+      values[8] = alpha_primal;
+      values[trace_alpha_pr_type_pos] = (Number)alpha_primal_char;
+      values[10] = (Number)ls_count;
+      values[11] = (Number)IpData().info_inertia_corrections();
+      values[12] = WallclockTime() - IpData().wallclock_time_start();
+      values[13] = timing.UpdateHessian().TotalWallclockTime();
+      values[14] = timing.ComputeSearchDirection().TotalWallclockTime();
+      values[15] = timing.ComputeAcceptableTrialPoint().TotalWallclockTime();
+      values[16] = timing.UpdateBarrierParameter().TotalWallclockTime();
+      values[17] = timing.CheckConvergence().TotalWallclockTime();
+      values[18] = timing.LinearSystemFactorization().TotalWallclockTime();
+      values[19] = timing.LinearSystemBackSolve().TotalWallclockTime();
+      WriteTraceRecord(values, alpha_primal_char);
+    }
+
 
     //////////////////////////////////////////////////////////////////////
     //           Now if desired more detail on the iterates             //
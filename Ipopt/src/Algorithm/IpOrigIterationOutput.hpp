@@ -67,6 +67,25 @@ namespace Ipopt
     int print_frequency_iter_;
     /** Option indicating at which time frequency the summary line should be printed */
     Number print_frequency_time_;
+
+    /** @name Machine-readable iteration trace */
+    //@{
+    /** Open the trace file and write the header (for the binary
+     *  format).  Returns false if the file could not be opened. */
+    bool OpenTraceFile(const std::string& fname);
+
+    /** Write one record with the given values to the trace file.
+     *  The values are given in the order of the fields in the
+     *  header. */
+    void WriteTraceRecord(const Number* values, char alpha_primal_char);
+
+    /** File for the iteration trace, NULL if no trace is written */
+    FILE* trace_file_;
+
+    /** Flag indicating whether the trace is written in binary format
+     *  (otherwise in JSON Lines format) */
+    bool trace_binary_;
+    //@}
   };
 
 } // namespace Ipopt
@@ -89,7 +89,10 @@ namespace Ipopt
       "Ipopt tests if the direction is a direction of positive curvature.  This "
       "tolerance is alpha_n in the paper by Zavala and Chiang (2014) and it "
       "determines when the direction is considered to be sufficiently positive. "
-      "A value in the range of [1e-12, 1e-11] is recommended.");
+      "A value in the range of [1e-12, 1e-11] is recommended.  If the "
+      "augmented system solver does not provide the inertia (e.g., for "
+      "aug_system_solver=krylov), the curvature of every step is tested, "
+      "and the default is 1e-12 instead.");
     roptions->AddStringOption2(
       "neg_curv_test_reg",
       "Whether to do the curvature test with the primal regularization (see Zavala and Chiang, 2014).",
@@ -114,7 +117,8 @@ namespace Ipopt
     ASSERT_EXCEPTION(residual_ratio_singular_ >= residual_ratio_max_, OPTION_INVALID,
                      "Option \"residual_ratio_singular\": This value must be not smaller than residual_ratio_max.");
     options.GetNumericValue("residual_improvement_factor", residual_improvement_factor_, prefix);
-    options.GetNumericValue("neg_curv_test_tol", neg_curv_test_tol_, prefix);
+    bool neg_curv_test_tol_set =
+      options.GetNumericValue("neg_curv_test_tol", neg_curv_test_tol_, prefix);
     options.GetBoolValue("neg_curv_test_reg", neg_curv_test_reg_, prefix);
 
     // Reset internal flags and data
@@ -125,6 +129,15 @@ namespace Ipopt
       return false;
     }
 
+    // Without the inertia, the curvature of every step is tested
+    if (!augSysSolver_->ProvidesInertia()) {
+      if (!neg_curv_test_tol_set) {
+        neg_curv_test_tol_ = 1e-12;
+      }
+      ASSERT_EXCEPTION(neg_curv_test_tol_ > 0., OPTION_INVALID,
+                       "Option \"neg_curv_test_tol\" must be positive if the augmented system solver does not provide the inertia.");
+    }
+
     return perturbHandler_->Initialize(Jnlst(), IpNLP(), IpData(), IpCq(),
                                        options, prefix);
   }
@@ -373,6 +386,212 @@ namespace Ipopt
     return true;
   }
 
+  bool PDFullSpaceSolver::MultiSolve(
+    const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+    std::vector<SmartPtr<IteratesVector> >& resV,
+    bool allow_inexact)
+  {
+    DBG_START_METH("PDFullSpaceSolver::MultiSolve",dbg_verbosity);
+    DBG_ASSERT(rhsV.size() == resV.size());
+
+    const Index nrhs = (Index)rhsV.size();
+    if (nrhs == 0) {
+      return true;
+    }
+
+    // Solve for the first right hand side with all the safeguards of
+    // Solve; this also factorizes the matrix, if necessary
+    if (!Solve(1., 0., *rhsV[0], *resV[0], allow_inexact)) {
+      return false;
+    }
+    if (nrhs == 1) {
+      return true;
+    }
+
+    IpData().TimingStats().PDSystemSolverTotal().Start();
+
+    // Now solve for the remaining right hand sides together
+    std::vector<SmartPtr<const IteratesVector> > rhs_rest(rhsV.begin()+1,
+        rhsV.end());
+    std::vector<SmartPtr<IteratesVector> > res_rest(resV.begin()+1,
+        resV.end());
+    if (!MultiSolveOnce(rhs_rest, res_rest)) {
+      // Fall back to solving one system after the other
+      IpData().TimingStats().PDSystemSolverTotal().End();
+      return PDSystemSolver::MultiSolve(rhs_rest, res_rest, allow_inexact);
+    }
+
+    if (!allow_inexact) {
+      // Iterative refinement for all right hand sides together
+      SmartPtr<const SymMatrix> W = IpData().W();
+      SmartPtr<const Matrix> J_c = IpCq().curr_jac_c();
+      SmartPtr<const Matrix> J_d = IpCq().curr_jac_d();
+      SmartPtr<const Matrix> Px_L = IpNLP().Px_L();
+      SmartPtr<const Matrix> Px_U = IpNLP().Px_U();
+      SmartPtr<const Matrix> Pd_L = IpNLP().Pd_L();
+      SmartPtr<const Matrix> Pd_U = IpNLP().Pd_U();
+      SmartPtr<const Vector> z_L = IpData().curr()->z_L();
+      SmartPtr<const Vector> z_U = IpData().curr()->z_U();
+      SmartPtr<const Vector> v_L = IpData().curr()->v_L();
+      SmartPtr<const Vector> v_U = IpData().curr()->v_U();
+      SmartPtr<const Vector> slack_x_L = IpCq().curr_slack_x_L();
+      SmartPtr<const Vector> slack_x_U = IpCq().curr_slack_x_U();
+      SmartPtr<const Vector> slack_s_L = IpCq().curr_slack_s_L();
+      SmartPtr<const Vector> slack_s_U = IpCq().curr_slack_s_U();
+      SmartPtr<const Vector> sigma_x = IpCq().curr_sigma_x();
+      SmartPtr<const Vector> sigma_s = IpCq().curr_sigma_s();
+
+      std::vector<bool> converged(nrhs-1, false);
+      for (Index num_iter_ref=0; ; num_iter_ref++) {
+        std::vector<Index> refine;
+        std::vector<SmartPtr<const IteratesVector> > residV;
+        std::vector<SmartPtr<IteratesVector> > corrV;
+        for (Index i=0; i<nrhs-1; i++) {
+          if (converged[i]) {
+            continue;
+          }
+          SmartPtr<IteratesVector> resid =
+            res_rest[i]->MakeNewIteratesVector(true);
+          ComputeResiduals(*W, *J_c, *J_d, *Px_L, *Px_U, *Pd_L, *Pd_U,
+                           *z_L, *z_U, *v_L, *v_U, *slack_x_L, *slack_x_U,
+                           *slack_s_L, *slack_s_U, *sigma_x, *sigma_s,
+                           1., 0., *rhs_rest[i], *res_rest[i], *resid);
+          Number residual_ratio =
+            ComputeResidualRatio(*rhs_rest[i], *res_rest[i], *resid);
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "residual_ratio for right hand side %d = %e\n",
+                         i+1, residual_ratio);
+          if (num_iter_ref >= min_refinement_steps_ &&
+              residual_ratio <= residual_ratio_max_) {
+            converged[i] = true;
+            continue;
+          }
+          refine.push_back(i);
+          residV.push_back(ConstPtr(resid));
+          corrV.push_back(res_rest[i]->MakeNewIteratesVector(true));
+        }
+        if (refine.empty()) {
+          break;
+        }
+        if (num_iter_ref >= max_refinement_steps_ ||
+            !MultiSolveOnce(residV, corrV)) {
+          // Let Solve deal with the remaining systems, including
+          // possible modifications of the matrix
+          Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                         "Iterative refinement for %d right hand sides is continued individually.\n",
+                         (Index)refine.size());
+          IpData().TimingStats().PDSystemSolverTotal().End();
+          for (Index k=0; k<(Index)refine.size(); k++) {
+            if (!Solve(1., 0., *rhs_rest[refine[k]], *res_rest[refine[k]],
+                       false, true)) {
+              return false;
+            }
+          }
+          return true;
+        }
+        for (Index k=0; k<(Index)refine.size(); k++) {
+          res_rest[refine[k]]->Axpy(-1., *corrV[k]);
+        }
+      }
+    }
+
+    IpData().TimingStats().PDSystemSolverTotal().End();
+
+    return true;
+  }
+
+  bool PDFullSpaceSolver::MultiSolveOnce(
+    const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+    std::vector<SmartPtr<IteratesVector> >& solV)
+  {
+    DBG_START_METH("PDFullSpaceSolver::MultiSolveOnce",dbg_verbosity);
+
+    IpData().TimingStats().PDSystemSolverSolveOnce().Start();
+
+    SmartPtr<const SymMatrix> W = IpData().W();
+    SmartPtr<const Matrix> J_c = IpCq().curr_jac_c();
+    SmartPtr<const Matrix> J_d = IpCq().curr_jac_d();
+    SmartPtr<const Matrix> Px_L = IpNLP().Px_L();
+    SmartPtr<const Matrix> Px_U = IpNLP().Px_U();
+    SmartPtr<const Matrix> Pd_L = IpNLP().Pd_L();
+    SmartPtr<const Matrix> Pd_U = IpNLP().Pd_U();
+    SmartPtr<const Vector> z_L = IpData().curr()->z_L();
+    SmartPtr<const Vector> z_U = IpData().curr()->z_U();
+    SmartPtr<const Vector> v_L = IpData().curr()->v_L();
+    SmartPtr<const Vector> v_U = IpData().curr()->v_U();
+    SmartPtr<const Vector> slack_x_L = IpCq().curr_slack_x_L();
+    SmartPtr<const Vector> slack_x_U = IpCq().curr_slack_x_U();
+    SmartPtr<const Vector> slack_s_L = IpCq().curr_slack_s_L();
+    SmartPtr<const Vector> slack_s_U = IpCq().curr_slack_s_U();
+    SmartPtr<const Vector> sigma_x = IpCq().curr_sigma_x();
+    SmartPtr<const Vector> sigma_s = IpCq().curr_sigma_s();
+
+    // Compute the right hand sides for the augmented system
+    const Index nrhs = (Index)rhsV.size();
+    std::vector<SmartPtr<const Vector> > rhs_xV(nrhs);
+    std::vector<SmartPtr<const Vector> > rhs_sV(nrhs);
+    std::vector<SmartPtr<const Vector> > rhs_cV(nrhs);
+    std::vector<SmartPtr<const Vector> > rhs_dV(nrhs);
+    std::vector<SmartPtr<Vector> > sol_xV(nrhs);
+    std::vector<SmartPtr<Vector> > sol_sV(nrhs);
+    std::vector<SmartPtr<Vector> > sol_cV(nrhs);
+    std::vector<SmartPtr<Vector> > sol_dV(nrhs);
+    for (Index i=0; i<nrhs; i++) {
+      const IteratesVector& rhs = *rhsV[i];
+      SmartPtr<Vector> augRhs_x = rhs.x()->MakeNewCopy();
+      Px_L->AddMSinvZ(1.0, *slack_x_L, *rhs.z_L(), *augRhs_x);
+      Px_U->AddMSinvZ(-1.0, *slack_x_U, *rhs.z_U(), *augRhs_x);
+      rhs_xV[i] = ConstPtr(augRhs_x);
+
+      SmartPtr<Vector> augRhs_s = rhs.s()->MakeNewCopy();
+      Pd_L->AddMSinvZ(1.0, *slack_s_L, *rhs.v_L(), *augRhs_s);
+      Pd_U->AddMSinvZ(-1.0, *slack_s_U, *rhs.v_U(), *augRhs_s);
+      rhs_sV[i] = ConstPtr(augRhs_s);
+
+      rhs_cV[i] = rhs.y_c();
+      rhs_dV[i] = rhs.y_d();
+
+      sol_xV[i] = solV[i]->x_NonConst();
+      sol_sV[i] = solV[i]->s_NonConst();
+      sol_cV[i] = solV[i]->y_c_NonConst();
+      sol_dV[i] = solV[i]->y_d_NonConst();
+    }
+
+    Number delta_x;
+    Number delta_s;
+    Number delta_c;
+    Number delta_d;
+    perturbHandler_->CurrentPerturbation(delta_x, delta_s, delta_c, delta_d);
+
+    ESymSolverStatus retval =
+      augSysSolver_->MultiSolve(GetRawPtr(W), 1.0, GetRawPtr(sigma_x), delta_x,
+                                GetRawPtr(sigma_s), delta_s, GetRawPtr(J_c),
+                                NULL, delta_c, GetRawPtr(J_d), NULL, delta_d,
+                                rhs_xV, rhs_sV, rhs_cV, rhs_dV,
+                                sol_xV, sol_sV, sol_cV, sol_dV, false, 0);
+    if (retval != SYMSOLVER_SUCCESS) {
+      Jnlst().Printf(J_DETAILED, J_LINEAR_ALGEBRA,
+                     "Solve for multiple right hand sides failed with retval = %d\n",
+                     retval);
+      IpData().TimingStats().PDSystemSolverSolveOnce().End();
+      return false;
+    }
+
+    // Compute the remaining solution vectors
+    for (Index i=0; i<nrhs; i++) {
+      const IteratesVector& rhs = *rhsV[i];
+      IteratesVector& sol = *solV[i];
+      Px_L->SinvBlrmZMTdBr(-1., *slack_x_L, *rhs.z_L(), *z_L, *sol.x(), *sol.z_L_NonConst());
+      Px_U->SinvBlrmZMTdBr(1., *slack_x_U, *rhs.z_U(), *z_U, *sol.x(), *sol.z_U_NonConst());
+      Pd_L->SinvBlrmZMTdBr(-1., *slack_s_L, *rhs.v_L(), *v_L, *sol.s(), *sol.v_L_NonConst());
+      Pd_U->SinvBlrmZMTdBr(1., *slack_s_U, *rhs.v_U(), *v_U, *sol.s(), *sol.v_U_NonConst());
+    }
+
+    IpData().TimingStats().PDSystemSolverSolveOnce().End();
+
+    return true;
+  }
+
   bool PDFullSpaceSolver::SolveOnce(bool resolve_with_better_quality,
                                     bool pretend_singular,
                                     const SymMatrix& W,
@@ -506,7 +725,7 @@ namespace Ipopt
           Jnlst().Printf(J_MOREDETAILED, J_LINEAR_ALGEBRA,
                          "Solving system with delta_x=%e delta_s=%e\n                    delta_c=%e delta_d=%e\n",
                          delta_x, delta_s, delta_c, delta_d);
-          bool check_inertia = true;
+          bool check_inertia = augSysSolver_->ProvidesInertia();
           if (neg_curv_test_tol_ > 0.) {
             check_inertia = false;
           }
@@ -581,10 +800,15 @@ namespace Ipopt
           }
         }
         else if (neg_curv_test_tol_ > 0.) {
-          DBG_ASSERT(augSysSolver_->ProvidesInertia());
-          // we now check if the inertia is possible wrong
-          Index neg_values = augSysSolver_->NumberOfNegEVals();
-          if (neg_values != numberOfEVals) {
+          // we now check if the inertia is possible wrong; if the
+          // solver does not provide the inertia, the curvature is
+          // always tested
+          bool test_curvature = true;
+          if (augSysSolver_->ProvidesInertia()) {
+            Index neg_values = augSysSolver_->NumberOfNegEVals();
+            test_curvature = (neg_values != numberOfEVals);
+          }
+          if (test_curvature) {
             // check if we have a direction of sufficient positive curvature
             SmartPtr<Vector> x_tmp = sol->x()->MakeNew();
             W.MultVector(1., *sol->x(), 0., *x_tmp);
@@ -634,6 +858,10 @@ namespace Ipopt
                      delta_x, delta_s, delta_c, delta_d);
       // Set the perturbation values in the Data object
       IpData().setPDPert(delta_x, delta_s, delta_c, delta_d);
+      if (count > 1) {
+        IpData().Set_info_inertia_corrections(
+          IpData().info_inertia_corrections() + count - 1);
+      }
     }
 
     // Compute the remaining sol Vectors
@@ -57,6 +57,15 @@ namespace Ipopt
                        bool allow_inexact=false,
                        bool improve_solution=false);
 
+    /** Solve the primal dual system for several right hand sides.
+     *  The matrix is factorized (if necessary) by solving the system
+     *  for the first right hand side; the remaining right hand sides
+     *  are then solved together, including the iterative refinement.
+     */
+    virtual bool MultiSolve(const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+                            std::vector<SmartPtr<IteratesVector> >& resV,
+                            bool allow_inexact=false);
+
     /** Methods for IpoptType */
     //@{
     static void RegisterOptions(SmartPtr<RegisteredOptions> roptions);
@@ -147,6 +156,16 @@ namespace Ipopt
                    const IteratesVector& rhs,
                    IteratesVector& res);
 
+    /** Internal function for backsolves with several right hand
+     *  sides for the current matrix, which must have been factorized
+     *  in a previous call of SolveOnce.  The solutions are stored in
+     *  solV, which must contain one vector for each right hand side.
+     *  This method returns false, if the augmented system solver
+     *  could not solve the systems.
+     */
+    bool MultiSolveOnce(const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+                        std::vector<SmartPtr<IteratesVector> >& solV);
+
     /** Internal function for computing the residual (resid) given the
      * right hand side (rhs) and the solution of the system (res).
      */
@@ -110,6 +110,27 @@ namespace Ipopt
                        bool allow_inexact=false,
                        bool improve_solution=false) =0;
 
+    /** Solve the primal dual system for several right hand sides
+     *  (with alpha=1 and beta=0).  resV must contain one vector for
+     *  each right hand side in rhsV.  The default implementation
+     *  calls Solve for one right hand side after the other; derived
+     *  classes may solve them together.  The return value is false,
+     *  if a solution could not be computed for one of the right hand
+     *  sides.
+     */
+    virtual bool MultiSolve(const std::vector<SmartPtr<const IteratesVector> >& rhsV,
+                            std::vector<SmartPtr<IteratesVector> >& resV,
+                            bool allow_inexact=false)
+    {
+      DBG_ASSERT(rhsV.size() == resV.size());
+      for (Index i=0; i<(Index)rhsV.size(); i++) {
+        if (!Solve(1., 0., *rhsV[i], *resV[i], allow_inexact)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
   private:
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
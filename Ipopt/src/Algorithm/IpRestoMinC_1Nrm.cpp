@@ -128,7 +128,8 @@ namespace Ipopt
     // ToDo set those up during initialize?
     // Create the restoration phase NLP etc objects
     SmartPtr<IpoptData> resto_ip_data =
-      new IpoptData(NULL, IpData().cpu_time_start());
+      new IpoptData(NULL, IpData().cpu_time_start(),
+                    IpData().wallclock_time_start());
     SmartPtr<IpoptNLP> resto_ip_nlp =
       new RestoIpoptNLP(IpNLP(), IpData(), IpCq());
     SmartPtr<IpoptCalculatedQuantities> resto_ip_cq =
@@ -282,6 +283,10 @@ namespace Ipopt
       THROW_EXCEPTION(RESTORATION_CPUTIME_EXCEEDED,
                       "Maximal CPU time exceeded in restoration phase.");
     }
+    else if (resto_status == WALLTIME_EXCEEDED) {
+      THROW_EXCEPTION(RESTORATION_WALLTIME_EXCEEDED,
+                      "Maximal wallclock time exceeded in restoration phase.");
+    }
     else if (resto_status == LOCAL_INFEASIBILITY) {
       // converged to locally infeasible point - pass this on to the outer algorithm...
       THROW_EXCEPTION(LOCALLY_INFEASIBLE, "Restoration phase converged to a point of local infeasibility");
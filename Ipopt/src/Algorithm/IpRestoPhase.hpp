@@ -26,6 +26,7 @@ namespace Ipopt
   DECLARE_STD_EXCEPTION(RESTORATION_FAILED);
   DECLARE_STD_EXCEPTION(RESTORATION_MAXITER_EXCEEDED);
   DECLARE_STD_EXCEPTION(RESTORATION_CPUTIME_EXCEEDED);
+  DECLARE_STD_EXCEPTION(RESTORATION_WALLTIME_EXCEEDED);
   DECLARE_STD_EXCEPTION(RESTORATION_USER_STOP);
   //@}
 
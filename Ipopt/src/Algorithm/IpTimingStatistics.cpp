@@ -8,39 +8,83 @@
 
 #include "IpTimingStatistics.hpp"
 
+#include <cstdio>
+
 namespace Ipopt
 {
+  TimingStatistics::TimingStatistics()
+  {
+    AddTask(OverallAlgorithm_, "OverallAlgorithm", 0);
+    AddTask(PrintProblemStatistics_, "PrintProblemStatistics", 1);
+    AddTask(InitializeIterates_, "InitializeIterates", 1);
+    AddTask(UpdateHessian_, "UpdateHessian", 1);
+    AddTask(OutputIteration_, "OutputIteration", 1);
+    AddTask(UpdateBarrierParameter_, "UpdateBarrierParameter", 1);
+    AddTask(ComputeSearchDirection_, "ComputeSearchDirection", 1);
+    AddTask(ComputeAcceptableTrialPoint_, "ComputeAcceptableTrialPoint", 1);
+    AddTask(AcceptTrialPoint_, "AcceptTrialPoint", 1);
+    AddTask(CheckConvergence_, "CheckConvergence", 1);
+
+    AddTask(PDSystemSolverTotal_, "PDSystemSolverTotal", 0);
+    AddTask(PDSystemSolverSolveOnce_, "PDSystemSolverSolveOnce", 1);
+    AddTask(ComputeResiduals_, "ComputeResiduals", 1);
+    AddTask(StdAugSystemSolverMultiSolve_, "StdAugSystemSolverMultiSolve", 1);
+    AddTask(LinearSystemScaling_, "LinearSystemScaling", 1);
+    AddTask(LinearSystemSymbolicFactorization_, "LinearSystemSymbolicFactorization", 1);
+    AddTask(LinearSystemFactorization_, "LinearSystemFactorization", 1);
+    AddTask(LinearSystemBackSolve_, "LinearSystemBackSolve", 1);
+    AddTask(LinearSystemStructureConverter_, "LinearSystemStructureConverter", 1);
+    AddTask(LinearSystemStructureConverterInit_, "LinearSystemStructureConverterInit", 2);
+    AddTask(QualityFunctionSearch_, "QualityFunctionSearch", 0);
+    AddTask(TryCorrector_, "TryCorrector", 0);
+
+    SetMeasureCpuTimes(false);
+  }
+
+  void
+  TimingStatistics::AddTask(TimedTask& task, const char* name, Index level)
+  {
+    task.SetName(name);
+    tasks_.push_back(&task);
+    task_levels_.push_back(level);
+  }
+
   void
   TimingStatistics::ResetTimes()
   {
-    OverallAlgorithm_.Reset();
-    PrintProblemStatistics_.Reset();
-    InitializeIterates_.Reset();
-    UpdateHessian_.Reset();
-    OutputIteration_.Reset();
-    UpdateBarrierParameter_.Reset();
-    ComputeSearchDirection_.Reset();
-    ComputeAcceptableTrialPoint_.Reset();
-    AcceptTrialPoint_.Reset();
-    CheckConvergence_.Reset();
-    PDSystemSolverTotal_.Reset();
-    PDSystemSolverSolveOnce_.Reset();
-    ComputeResiduals_.Reset();
-    StdAugSystemSolverMultiSolve_.Reset();
-    LinearSystemScaling_.Reset();
-    LinearSystemSymbolicFactorization_.Reset();
-    LinearSystemFactorization_.Reset();
-    LinearSystemBackSolve_.Reset();
-    LinearSystemStructureConverter_.Reset();
-    LinearSystemStructureConverterInit_.Reset();
-    QualityFunctionSearch_.Reset();
-    TryCorrector_.Reset();
-    Task1_.Reset();
-    Task2_.Reset();
-    Task3_.Reset();
-    Task4_.Reset();
-    Task5_.Reset();
-    Task6_.Reset();
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      tasks_[i]->Reset();
+    }
+  }
+
+  void
+  TimingStatistics::SetMeasureCpuTimes(bool measure_cputimes)
+  {
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      if (tasks_[i] != &OverallAlgorithm_) {
+        tasks_[i]->SetMeasureCpuTime(measure_cputimes);
+      }
+    }
+  }
+
+  void
+  TimingStatistics::SetTrace(bool trace)
+  {
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      tasks_[i]->SetTrace(trace);
+    }
+  }
+
+  /** Label of a task in the output, indented according to its level
+   *  and filled up with dots. */
+  static std::string TaskLabel(const TimedTask& task, Index level)
+  {
+    std::string label(level, ' ');
+    label += task.Name();
+    if (label.size() < 36) {
+      label.append(36 - label.size(), '.');
+    }
+    return label;
   }
 
   void
@@ -52,141 +96,65 @@ namespace Ipopt
     if (!jnlst.ProduceOutput(level, category))
       return;
 
-    jnlst.Printf(level, category,
-                 "OverallAlgorithm....................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 OverallAlgorithm_.TotalCpuTime(),
-                 OverallAlgorithm_.TotalSysTime(),
-                 OverallAlgorithm_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " PrintProblemStatistics.............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 PrintProblemStatistics_.TotalCpuTime(),
-                 PrintProblemStatistics_.TotalSysTime(),
-                 PrintProblemStatistics_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " InitializeIterates.................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 InitializeIterates_.TotalCpuTime(),
-                 InitializeIterates_.TotalSysTime(),
-                 InitializeIterates_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " UpdateHessian......................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 UpdateHessian_.TotalCpuTime(),
-                 UpdateHessian_.TotalSysTime(),
-                 UpdateHessian_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " OutputIteration....................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 OutputIteration_.TotalCpuTime(),
-                 OutputIteration_.TotalSysTime(),
-                 OutputIteration_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " UpdateBarrierParameter.............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 UpdateBarrierParameter_.TotalCpuTime(),
-                 UpdateBarrierParameter_.TotalSysTime(),
-                 UpdateBarrierParameter_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " ComputeSearchDirection.............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 ComputeSearchDirection_.TotalCpuTime(),
-                 ComputeSearchDirection_.TotalSysTime(),
-                 ComputeSearchDirection_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " ComputeAcceptableTrialPoint........: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 ComputeAcceptableTrialPoint_.TotalCpuTime(),
-                 ComputeAcceptableTrialPoint_.TotalSysTime(),
-                 ComputeAcceptableTrialPoint_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " AcceptTrialPoint...................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 AcceptTrialPoint_.TotalCpuTime(),
-                 AcceptTrialPoint_.TotalSysTime(),
-                 AcceptTrialPoint_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " CheckConvergence...................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 CheckConvergence_.TotalCpuTime(),
-                 CheckConvergence_.TotalSysTime(),
-                 CheckConvergence_.TotalWallclockTime());
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      const TimedTask& task = *tasks_[i];
+      jnlst.Printf(level, category,
+                   "%s: %10.3f (sys: %10.3f wall: %10.3f)\n",
+                   TaskLabel(task, task_levels_[i]).c_str(),
+                   task.TotalCpuTime(),
+                   task.TotalSysTime(),
+                   task.TotalWallclockTime());
+    }
 
     jnlst.Printf(level, category,
-                 "PDSystemSolverTotal.................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 PDSystemSolverTotal_.TotalCpuTime(),
-                 PDSystemSolverTotal_.TotalSysTime(),
-                 PDSystemSolverTotal_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " PDSystemSolverSolveOnce............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 PDSystemSolverSolveOnce_.TotalCpuTime(),
-                 PDSystemSolverSolveOnce_.TotalSysTime(),
-                 PDSystemSolverSolveOnce_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " ComputeResiduals...................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 ComputeResiduals_.TotalCpuTime(),
-                 ComputeResiduals_.TotalSysTime(),
-                 ComputeResiduals_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " StdAugSystemSolverMultiSolve.......: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 StdAugSystemSolverMultiSolve_.TotalCpuTime(),
-                 StdAugSystemSolverMultiSolve_.TotalSysTime(),
-                 StdAugSystemSolverMultiSolve_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " LinearSystemScaling................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemScaling_.TotalCpuTime(),
-                 LinearSystemScaling_.TotalSysTime(),
-                 LinearSystemScaling_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " LinearSystemSymbolicFactorization..: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemSymbolicFactorization_.TotalCpuTime(),
-                 LinearSystemSymbolicFactorization_.TotalSysTime(),
-                 LinearSystemSymbolicFactorization_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " LinearSystemFactorization..........: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemFactorization_.TotalCpuTime(),
-                 LinearSystemFactorization_.TotalSysTime(),
-                 LinearSystemFactorization_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " LinearSystemBackSolve..............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemBackSolve_.TotalCpuTime(),
-                 LinearSystemBackSolve_.TotalSysTime(),
-                 LinearSystemBackSolve_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 " LinearSystemStructureConverter.....: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemStructureConverter_.TotalCpuTime(),
-                 LinearSystemStructureConverter_.TotalSysTime(),
-                 LinearSystemStructureConverter_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "  LinearSystemStructureConverterInit: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 LinearSystemStructureConverterInit_.TotalCpuTime(),
-                 LinearSystemStructureConverterInit_.TotalSysTime(),
-                 LinearSystemStructureConverterInit_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "QualityFunctionSearch...............: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 QualityFunctionSearch_.TotalCpuTime(),
-                 QualityFunctionSearch_.TotalSysTime(),
-                 QualityFunctionSearch_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "TryCorrector........................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 TryCorrector_.TotalCpuTime(),
-                 TryCorrector_.TotalSysTime(),
-                 TryCorrector_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "Task1...............................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 Task1_.TotalCpuTime(),
-                 Task1_.TotalSysTime(),
-                 Task1_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "Task2...............................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 Task2_.TotalCpuTime(),
-                 Task2_.TotalSysTime(),
-                 Task2_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "Task3...............................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 Task3_.TotalCpuTime(),
-                 Task3_.TotalSysTime(),
-                 Task3_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "Task4...............................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 Task4_.TotalCpuTime(),
-                 Task4_.TotalSysTime(),
-                 Task4_.TotalWallclockTime());
-    jnlst.Printf(level, category,
-                 "Task5...............................: %10.3f (sys: %10.3f wall: %10.3f)\n",
-                 Task5_.TotalCpuTime(),
-                 Task5_.TotalSysTime(),
-                 Task5_.TotalWallclockTime());
+                 "\nWall clock time per call (in milliseconds):\n\n"
+                 "%36s  %10s %10s %10s %10s\n",
+                 "", "calls", "min", "avg", "max");
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      const TimedTask& task = *tasks_[i];
+      if (task.NumberOfCalls() == 0) {
+        continue;
+      }
+      jnlst.Printf(level, category,
+                   "%s: %10d %10.3f %10.3f %10.3f\n",
+                   TaskLabel(task, task_levels_[i]).c_str(),
+                   task.NumberOfCalls(),
+                   1e3*task.MinWallclockTime(),
+                   1e3*task.TotalWallclockTime()/task.NumberOfCalls(),
+                   1e3*task.MaxWallclockTime());
+    }
+  }
+
+  bool
+  TimingStatistics::WriteTraceFile(const std::string& filename) const
+  {
+    FILE* file = fopen(filename.c_str(), "w");
+    if (!file) {
+      return false;
+    }
+
+    // All times are written in microseconds.  Calls of nested tasks
+    // lie within the calls of the enclosing tasks, so that viewers
+    // display them as a flame graph.
+    fprintf(file, "{\"traceEvents\":[\n");
+    bool first = true;
+    for (Index i=0; i<(Index)tasks_.size(); i++) {
+      const std::vector<std::pair<Number, Number> >& events =
+        tasks_[i]->TraceEvents();
+      for (Index j=0; j<(Index)events.size(); j++) {
+        fprintf(file, "%s{\"name\":\"%s\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+                "\"ts\":%.3f,\"dur\":%.3f}",
+                first ? "" : ",\n", tasks_[i]->Name(),
+                1e6*events[j].first, 1e6*events[j].second);
+        first = false;
+      }
+    }
+    fprintf(file, "\n],\"displayTimeUnit\":\"ms\"}\n");
+
+    bool success = (ferror(file) == 0);
+    if (fclose(file) != 0) {
+      success = false;
+    }
+    return success;
   }
 } // namespace Ipopt
@@ -13,9 +13,18 @@
 #include "IpJournalist.hpp"
 #include "IpTimedTask.hpp"
 
+#include <vector>
+
 namespace Ipopt
 {
   /** This class collects all timing statistics for Ipopt.
+   *
+   *  The timed tasks form a hierarchy (e.g., LinearSystemBackSolve is
+   *  executed within PDSystemSolverTotal), which is used for the
+   *  output.  Only the CPU time of OverallAlgorithm is measured by
+   *  default; the CPU and system times of the other tasks are only
+   *  measured after SetMeasureCpuTimes(true), since this requires two
+   *  additional system calls for each execution of a task.
    */
   class TimingStatistics : public ReferencedObject
   {
@@ -23,8 +32,7 @@ namespace Ipopt
     /**@name Constructors/Destructors */
     //@{
     /** Default constructor. */
-    TimingStatistics()
-    {}
+    TimingStatistics();
 
     /** Default destructor */
     virtual ~TimingStatistics()
@@ -34,11 +42,48 @@ namespace Ipopt
     /** Method for resetting all times. */
     void ResetTimes();
 
+    /** Method for switching the measurement of the CPU and system
+     *  times of all tasks other than OverallAlgorithm on or off. */
+    void SetMeasureCpuTimes(bool measure_cputimes);
+
+    /** Method for switching the recording of the individual calls of
+     *  all tasks on or off. */
+    void SetTrace(bool trace);
+
     /** Method for printing all timing information */
     void PrintAllTimingStatistics(Journalist& jnlst,
                                   EJournalLevel level,
                                   EJournalCategory category) const;
 
+    /** Method for writing the recorded calls of all tasks to a file
+     *  in the Trace Event Format, which can be loaded in Chrome
+     *  (chrome://tracing) and other trace viewers.  Returns false if
+     *  the file could not be written. */
+    bool WriteTraceFile(const std::string& filename) const;
+
+    /**@name Generic access to all timed tasks, in the order of the
+     * output. */
+    //@{
+    /** Number of timed tasks */
+    Index NumberOfTasks() const
+    {
+      return (Index)tasks_.size();
+    }
+    /** Timed task number i */
+    const TimedTask& Task(Index i) const
+    {
+      DBG_ASSERT(i >= 0 && i < NumberOfTasks());
+      return *tasks_[i];
+    }
+    /** Level of task number i in the hierarchy of the tasks (0 for
+     *  tasks that are not executed within another task) */
+    Index TaskLevel(Index i) const
+    {
+      DBG_ASSERT(i >= 0 && i < NumberOfTasks());
+      return task_levels_[i];
+    }
+    //@}
+
     /**@name Accessor methods to all timed tasks. */
     //@{
     TimedTask& OverallAlgorithm()
@@ -130,31 +175,6 @@ namespace Ipopt
     {
       return TryCorrector_;
     }
-
-    TimedTask& Task1()
-    {
-      return Task1_;
-    }
-    TimedTask& Task2()
-    {
-      return Task2_;
-    }
-    TimedTask& Task3()
-    {
-      return Task3_;
-    }
-    TimedTask& Task4()
-    {
-      return Task4_;
-    }
-    TimedTask& Task5()
-    {
-      return Task5_;
-    }
-    TimedTask& Task6()
-    {
-      return Task6_;
-    }
     //@}
 
   private:
@@ -173,6 +193,16 @@ namespace Ipopt
     void operator=(const TimingStatistics&);
     //@}
 
+    /** Add a task to the list of all tasks, with its name and its
+     *  level in the hierarchy of the tasks. */
+    void AddTask(TimedTask& task, const char* name, Index level);
+
+    /** @name List of all tasks in the order of the output */
+    //@{
+    std::vector<TimedTask*> tasks_;
+    std::vector<Index> task_levels_;
+    //@}
+
     /**@name All timed tasks. */
     //@{
     TimedTask OverallAlgorithm_;
@@ -198,13 +228,6 @@ namespace Ipopt
     TimedTask LinearSystemStructureConverterInit_;
     TimedTask QualityFunctionSearch_;
     TimedTask TryCorrector_;
-
-    TimedTask Task1_;
-    TimedTask Task2_;
-    TimedTask Task3_;
-    TimedTask Task4_;
-    TimedTask Task5_;
-    TimedTask Task6_;
     //@}
   };
 
@@ -636,6 +636,10 @@ namespace Ipopt
       message = "Maximum CPU Time Exceeded.";
       solve_result_num = 401;
     }
+    else if (status == WALLTIME_EXCEEDED) {
+      message = "Maximum Wallclock Time Exceeded.";
+      solve_result_num = 402;
+    }
     else if (status == STOP_AT_TINY_STEP) {
       message = "Search Direction becomes Too Small.";
       solve_result_num = 500;
@@ -1151,6 +1155,10 @@ namespace Ipopt
                                      "max_cpu_time",
                                      AmplOptionsList::Number_Option,
                                      "CPU time limit");
+    ampl_options_list->AddAmplOption("max_wall_time",
+                                     "max_wall_time",
+                                     AmplOptionsList::Number_Option,
+                                     "Wallclock time limit");
     ampl_options_list->AddAmplOption("compl_inf_tol",
                                      "compl_inf_tol",
                                      AmplOptionsList::Number_Option,
@@ -0,0 +1,780 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+// Batch driver for the AMPL interface.  It reads a manifest with the
+// names of .nl stubs and solves all of them, writing one consolidated
+// report with the return status, iteration and evaluation counts, and
+// timings for each model.
+//
+// Usage:
+//
+//   ipopt_batch [-j N] [-time_limit SEC] [-grace SEC] [-report FILE]
+//               [-log DIR] [-opt FILE] [-no_reuse] MANIFEST
+//
+// Each non-empty line of the manifest that does not start with '#'
+// names one stub, optionally followed by keyword=value options that
+// are passed to the solver in the same way as on the command line of
+// the ipopt executable, e.g.
+//
+//   models/hs071.nl
+//   models/large.nl  max_iter=500 mu_strategy=adaptive
+//
+// The models are solved by a pool of N worker processes.  Each worker
+// owns the AmplTNLP and therefore the ASL instance for the model it
+// solves; the ASL keeps global state, so
+// that models cannot be solved concurrently within one process.
+// This also means that a model that crashes or runs out of memory
+// does not bring down the whole batch.  If a time limit is given, it
+// is passed to Ipopt as max_wall_time (unless the model sets it), and
+// a worker that has not finished within the time limit plus the
+// grace period (default 5 seconds) is killed.
+//
+// Reading the .nl file can take as long as the solve itself.  Since
+// the AmplTNLP can be used for several optimizations, all entries of
+// the manifest with the same stub are solved by the same worker, which
+// reads the stub only once.  The AMPL interface options of the first
+// of these entries are applied when the stub is read; for the other
+// entries, the keyword=value options must be Ipopt options.  If a
+// worker is killed or crashes, the entries it has not solved yet are
+// given to a new worker, which reads the stub again with the AMPL
+// interface options of the original first entry.  Reading every entry anew can be requested
+// with -no_reuse.
+//
+// On platforms without fork (Windows), the models are solved one after
+// the other in the driver process, and the time limit is only enforced
+// through max_wall_time.
+
+#include "AmplTNLP.hpp"
+#include "IpIpoptApplication.hpp"
+#include "IpSolveStatistics.hpp"
+
+#include "IpoptConfig.h"
+#ifdef HAVE_CSTRING
+# include <cstring>
+#else
+# ifdef HAVE_STRING_H
+#  include <string.h>
+# else
+#  error "don't have header file for string"
+# endif
+#endif
+
+#ifdef HAVE_CSTDIO
+# include <cstdio>
+#else
+# ifdef HAVE_STDIO_H
+#  include <stdio.h>
+# else
+#  error "don't have header file for stdio"
+# endif
+#endif
+
+#ifdef HAVE_CSTDLIB
+# include <cstdlib>
+#else
+# ifdef HAVE_STDLIB_H
+#  include <stdlib.h>
+# else
+#  error "don't have header file for stdlib"
+# endif
+#endif
+
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#ifndef _WIN32
+# define IPOPT_BATCH_FORK
+# include <unistd.h>
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+#endif
+
+using namespace Ipopt;
+
+/** One entry of the manifest */
+struct BatchModel
+{
+  /** Name of the .nl stub */
+  std::string stub;
+  /** Additional keyword=value options for this model */
+  std::vector<std::string> options;
+};
+
+/** A group of entries of the manifest with the same stub, which are
+ *  solved one after the other by the same worker */
+struct BatchJob
+{
+  /** Entries of the manifest solved by this job */
+  std::vector<size_t> entries;
+  /** Entry whose AMPL interface options are used for reading the
+   *  stub.  This is the first entry of the job as created from the
+   *  manifest; it stays the same when the remaining entries of a
+   *  failed worker are given to a new worker. */
+  size_t read_entry;
+};
+
+/** Outcome of the solution of one model */
+struct BatchResult
+{
+  /** Status of the run: an Ipopt return status, READ_ERROR if the
+   *  .nl file could not be read, or TIMEOUT, CRASHED, NO_RESULT if
+   *  the worker did not report back */
+  std::string status;
+  /** Ipopt return code, or -999 if the worker did not report back */
+  int return_code;
+  Index iterations;
+  Number objective;
+  /** Wall clock time for reading the .nl file (zero if the model was
+   *  read for a previous entry) */
+  Number read_time;
+  /** Wall clock time for reading the model and solving it */
+  Number total_wall_time;
+  /** Wall clock and CPU time of the optimization as reported by
+   *  Ipopt */
+  Number solve_wall_time;
+  Number solve_cpu_time;
+  /** Evaluation counts */
+  Index n_obj;
+  Index n_con;
+  Index n_grad;
+  Index n_jac;
+  Index n_hess;
+};
+
+static void InitResult(BatchResult& res)
+{
+  res.status = "NO_RESULT";
+  res.return_code = -999;
+  res.iterations = -1;
+  res.objective = 0.;
+  res.read_time = 0.;
+  res.total_wall_time = 0.;
+  res.solve_wall_time = 0.;
+  res.solve_cpu_time = 0.;
+  res.n_obj = -1;
+  res.n_con = -1;
+  res.n_grad = -1;
+  res.n_jac = -1;
+  res.n_hess = -1;
+}
+
+static const char* StatusName(int status)
+{
+  switch (status) {
+    case Solve_Succeeded:
+      return "Solve_Succeeded";
+    case Solved_To_Acceptable_Level:
+      return "Solved_To_Acceptable_Level";
+    case Infeasible_Problem_Detected:
+      return "Infeasible_Problem_Detected";
+    case Search_Direction_Becomes_Too_Small:
+      return "Search_Direction_Becomes_Too_Small";
+    case Diverging_Iterates:
+      return "Diverging_Iterates";
+    case User_Requested_Stop:
+      return "User_Requested_Stop";
+    case Feasible_Point_Found:
+      return "Feasible_Point_Found";
+    case Maximum_Iterations_Exceeded:
+      return "Maximum_Iterations_Exceeded";
+    case Restoration_Failed:
+      return "Restoration_Failed";
+    case Error_In_Step_Computation:
+      return "Error_In_Step_Computation";
+    case Maximum_CpuTime_Exceeded:
+      return "Maximum_CpuTime_Exceeded";
+    case Maximum_WallTime_Exceeded:
+      return "Maximum_WallTime_Exceeded";
+    case Not_Enough_Degrees_Of_Freedom:
+      return "Not_Enough_Degrees_Of_Freedom";
+    case Invalid_Problem_Definition:
+      return "Invalid_Problem_Definition";
+    case Invalid_Option:
+      return "Invalid_Option";
+    case Invalid_Number_Detected:
+      return "Invalid_Number_Detected";
+    case Unrecoverable_Exception:
+      return "Unrecoverable_Exception";
+    case NonIpopt_Exception_Thrown:
+      return "NonIpopt_Exception_Thrown";
+    case Insufficient_Memory:
+      return "Insufficient_Memory";
+    case Internal_Error:
+      return "Internal_Error";
+  }
+  return "Unknown";
+}
+
+/** Name of the log file for a model in the log directory: the stub
+ *  name with directories and extension stripped, prefixed with the
+ *  position in the manifest to keep the names unique. */
+static std::string LogFileName(const std::string& logdir,
+                               size_t idx,
+                               const std::string& stub)
+{
+  std::string base = stub;
+  std::string::size_type pos = base.find_last_of("/\\");
+  if (pos != std::string::npos) {
+    base = base.substr(pos + 1);
+  }
+  pos = base.rfind(".nl");
+  if (pos != std::string::npos && pos + 3 == base.size()) {
+    base = base.substr(0, pos);
+  }
+  char buf[32];
+  sprintf(buf, "%05d_", (int)idx);
+  return logdir + "/" + buf + base + ".log";
+}
+
+#ifdef IPOPT_BATCH_FORK
+/** Redirect stdout and stderr of the current (worker) process to the
+ *  given file. */
+static void RedirectOutput(const std::string& log)
+{
+  fflush(stdout);
+  fflush(stderr);
+  int logfd = open(log.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (logfd >= 0) {
+    dup2(logfd, 1);
+    dup2(logfd, 2);
+    close(logfd);
+  }
+}
+#endif
+
+/** Solve all entries of a job (which all have the same stub) one
+ *  after the other within the current process.  The AMPL interface
+ *  (and with it the ASL instance) is created for the first entry,
+ *  with the options of the read entry of the job, and reused for the
+ *  others.  If fd is nonnegative, the current process
+ *  is a worker: the solver output of each entry is redirected to its
+ *  own log file in logdir (or discarded if logdir is empty), and the
+ *  result of each entry is written to fd as soon as it is
+ *  available. */
+static void SolveJob(const std::vector<BatchModel>& models,
+                     const BatchJob& batch_job,
+                     const std::string& options_file,
+                     const std::string& logdir,
+                     Number time_limit,
+                     int fd,
+                     std::vector<BatchResult>& results)
+{
+  const std::vector<size_t>& job = batch_job.entries;
+  SmartPtr<TNLP> ampl_tnlp;
+
+  for (size_t k = 0; k < job.size(); k++) {
+    const BatchModel& model = models[job[k]];
+    BatchResult& res = results[job[k]];
+#ifdef IPOPT_BATCH_FORK
+    if (fd >= 0) {
+      RedirectOutput(logdir.empty() ? std::string("/dev/null") :
+                     LogFileName(logdir, job[k], model.stub));
+    }
+#endif
+    Number start = WallclockTime();
+
+    SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+    app->RethrowNonIpoptException(false);
+
+    ApplicationReturnStatus retval = app->Initialize("");
+    if (retval == Solve_Succeeded && IsNull(ampl_tnlp)) {
+      SmartPtr<AmplSuffixHandler> suffix_handler = new AmplSuffixHandler();
+      suffix_handler->AddAvailableSuffix("scaling_factor", AmplSuffixHandler::Variable_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("scaling_factor", AmplSuffixHandler::Constraint_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("scaling_factor", AmplSuffixHandler::Objective_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("ipopt_zL_out", AmplSuffixHandler::Variable_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("ipopt_zU_out", AmplSuffixHandler::Variable_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("ipopt_zL_in", AmplSuffixHandler::Variable_Source, AmplSuffixHandler::Number_Type);
+      suffix_handler->AddAvailableSuffix("ipopt_zU_in", AmplSuffixHandler::Variable_Source, AmplSuffixHandler::Number_Type);
+
+      // Build the argument list the AMPL interface expects from the
+      // command line: program name, stub, and keyword=value options
+      const BatchModel& read_model = models[batch_job.read_entry];
+      std::vector<char*> argv_vec;
+      argv_vec.push_back(const_cast<char*>("ipopt"));
+      argv_vec.push_back(const_cast<char*>(read_model.stub.c_str()));
+      for (size_t i = 0; i < read_model.options.size(); i++) {
+        argv_vec.push_back(const_cast<char*>(read_model.options[i].c_str()));
+      }
+      argv_vec.push_back(NULL);
+      char** argv = &argv_vec[0];
+
+      // If the stub is read for another entry (because the worker
+      // that started the job failed), the Ipopt options of the read
+      // entry must not be used for this one, so that they are
+      // collected in a separate options list
+      SmartPtr<OptionsList> read_options = app->Options();
+      if (job[k] != batch_job.read_entry) {
+        read_options = new OptionsList(*app->Options());
+        read_options->SetJournalist(app->Jnlst());
+      }
+
+      try {
+        ampl_tnlp = new AmplTNLP(ConstPtr(app->Jnlst()),
+                                 read_options,
+                                 argv, suffix_handler);
+      }
+      catch (IpoptException& exc) {
+        exc.ReportException(*app->Jnlst());
+        res.status = "READ_ERROR";
+      }
+      res.read_time = WallclockTime() - start;
+    }
+    if (retval == Solve_Succeeded && IsValid(ampl_tnlp) &&
+        job[k] != batch_job.read_entry) {
+      // The model has been read before, or with the options of
+      // another entry; pass the options of this entry on in the same
+      // way as the AMPL interface does
+      std::string opts;
+      for (size_t i = 0; i < model.options.size(); i++) {
+        std::string::size_type pos = model.options[i].find('=');
+        if (pos != std::string::npos) {
+          opts += model.options[i].substr(0, pos) + " " +
+                  model.options[i].substr(pos + 1) + "\n";
+        }
+        else {
+          opts += model.options[i] + "\n";
+        }
+      }
+      std::istringstream is(opts);
+      try {
+        if (!app->Options()->ReadFromStream(*app->Jnlst(), is, true)) {
+          retval = Invalid_Option;
+        }
+      }
+      catch (IpoptException& exc) {
+        exc.ReportException(*app->Jnlst());
+        retval = Invalid_Option;
+      }
+    }
+
+    if (retval == Solve_Succeeded && IsValid(ampl_tnlp)) {
+      retval = app->Initialize(options_file);
+      if (retval == Solve_Succeeded) {
+        if (time_limit > 0.) {
+          app->Options()->SetNumericValueIfUnset("max_wall_time", time_limit);
+        }
+        retval = app->OptimizeTNLP(ampl_tnlp);
+
+        SmartPtr<SolveStatistics> stats = app->Statistics();
+        if (IsValid(stats)) {
+          res.iterations = stats->IterationCount();
+          res.objective = stats->FinalObjective();
+          res.solve_wall_time = stats->TotalWallclockTime();
+          res.solve_cpu_time = stats->TotalCpuTime();
+          stats->NumberOfEvaluations(res.n_obj, res.n_con, res.n_grad,
+                                     res.n_jac, res.n_hess);
+        }
+      }
+    }
+    if (IsValid(ampl_tnlp) || retval != Solve_Succeeded) {
+      res.return_code = retval;
+      res.status = StatusName(retval);
+    }
+    res.total_wall_time = WallclockTime() - start;
+
+#ifdef IPOPT_BATCH_FORK
+    if (fd >= 0) {
+      fflush(stdout);
+      char buf[512];
+      int len = snprintf(buf, sizeof(buf),
+                         "%d %s %d %d %.17g %.17g %.17g %.17g %.17g %d %d %d %d %d\n",
+                         (int)job[k], res.status.c_str(), res.return_code,
+                         res.iterations, res.objective, res.read_time,
+                         res.total_wall_time, res.solve_wall_time,
+                         res.solve_cpu_time, res.n_obj, res.n_con,
+                         res.n_grad, res.n_jac, res.n_hess);
+      if (write(fd, buf, len) != len) {
+        _exit(2);
+      }
+    }
+#endif
+  }
+}
+
+/** Group the entries of the manifest into jobs.  If reuse is true,
+ *  all entries with the same stub form one job, otherwise each entry
+ *  is a job of its own. */
+static void MakeJobs(const std::vector<BatchModel>& models,
+                     bool reuse,
+                     std::vector<BatchJob>& jobs)
+{
+  std::map<std::string, size_t> job_of_stub;
+  for (size_t i = 0; i < models.size(); i++) {
+    if (reuse) {
+      std::map<std::string, size_t>::iterator it =
+        job_of_stub.find(models[i].stub);
+      if (it != job_of_stub.end()) {
+        jobs[it->second].entries.push_back(i);
+        continue;
+      }
+      job_of_stub[models[i].stub] = jobs.size();
+    }
+    BatchJob job;
+    job.entries.push_back(i);
+    job.read_entry = i;
+    jobs.push_back(job);
+  }
+}
+
+static void PrintProgress(const std::vector<BatchModel>& models,
+                          const std::vector<BatchResult>& results,
+                          size_t idx,
+                          size_t n_done)
+{
+  printf("%5d/%d  %-40s %-35s %10.3f s\n", (int)n_done,
+         (int)models.size(), models[idx].stub.c_str(),
+         results[idx].status.c_str(), results[idx].total_wall_time);
+  fflush(stdout);
+}
+
+/** Read the manifest.  Returns false if the file cannot be opened. */
+static bool ReadManifest(const std::string& fname,
+                         std::vector<BatchModel>& models)
+{
+  std::ifstream is(fname.c_str());
+  if (!is) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(is, line)) {
+    std::istringstream ls(line);
+    std::string token;
+    if (!(ls >> token) || token[0] == '#') {
+      continue;
+    }
+    BatchModel model;
+    model.stub = token;
+    while (ls >> token) {
+      model.options.push_back(token);
+    }
+    models.push_back(model);
+  }
+  return true;
+}
+
+#ifdef IPOPT_BATCH_FORK
+/** Bookkeeping for a running worker process */
+struct Worker
+{
+  pid_t pid;
+  int fd;
+  /** Entries of the manifest solved by this worker */
+  BatchJob job;
+  /** Number of entries for which the result has been received */
+  size_t n_reported;
+  /** Time at which the current entry was started */
+  Number start;
+  /** Output of the worker that has not been processed yet */
+  std::string buffer;
+};
+
+/** Process the complete result lines that a worker has sent. */
+static void ParseResults(Worker& w,
+                         const std::vector<BatchModel>& models,
+                         std::vector<BatchResult>& results,
+                         size_t& n_done)
+{
+  std::string::size_type pos;
+  while ((pos = w.buffer.find('\n')) != std::string::npos) {
+    std::string line = w.buffer.substr(0, pos);
+    w.buffer.erase(0, pos + 1);
+    int idx;
+    char status[64];
+    BatchResult res;
+    InitResult(res);
+    if (sscanf(line.c_str(),
+               "%d %63s %d %d %lg %lg %lg %lg %lg %d %d %d %d %d",
+               &idx, status, &res.return_code, &res.iterations,
+               &res.objective, &res.read_time, &res.total_wall_time,
+               &res.solve_wall_time, &res.solve_cpu_time, &res.n_obj,
+               &res.n_con, &res.n_grad, &res.n_jac, &res.n_hess) != 14 ||
+        idx < 0 || idx >= (int)models.size()) {
+      continue;
+    }
+    res.status = status;
+    results[idx] = res;
+    w.n_reported++;
+    w.start = WallclockTime();
+    PrintProgress(models, results, idx, ++n_done);
+  }
+}
+
+/** Read all output that is available from a worker. */
+static void ReadWorker(Worker& w)
+{
+  char buf[4096];
+  ssize_t len;
+  while ((len = read(w.fd, buf, sizeof(buf))) > 0) {
+    w.buffer.append(buf, len);
+  }
+}
+
+/** Solve the jobs with a pool of worker processes. */
+static void SolveAll(const std::vector<BatchModel>& models,
+                     std::vector<BatchJob>& jobs,
+                     const std::string& options_file,
+                     const std::string& logdir,
+                     Number time_limit,
+                     Number grace,
+                     int n_workers,
+                     std::vector<BatchResult>& results)
+{
+  std::vector<Worker> running;
+  size_t next = 0;
+  size_t n_done = 0;
+
+  while (next < jobs.size() || !running.empty()) {
+    // Start new workers while there are free slots
+    while ((int)running.size() < n_workers && next < jobs.size()) {
+      int fds[2];
+      if (pipe(fds) != 0) {
+        perror("ipopt_batch: pipe");
+        exit(-1);
+      }
+      fflush(stdout);
+      fflush(stderr);
+      Worker w;
+      w.job = jobs[next];
+      w.n_reported = 0;
+      w.start = WallclockTime();
+      w.pid = fork();
+      if (w.pid < 0) {
+        perror("ipopt_batch: fork");
+        exit(-1);
+      }
+      if (w.pid == 0) {
+        // Worker: solve the models; SolveJob redirects the solver
+        // output of each of them to its log file
+        close(fds[0]);
+        SolveJob(models, w.job, options_file, logdir, time_limit, fds[1],
+                 results);
+        _exit(0);
+      }
+      close(fds[1]);
+      w.fd = fds[0];
+      fcntl(w.fd, F_SETFL, fcntl(w.fd, F_GETFL) | O_NONBLOCK);
+      running.push_back(w);
+      next++;
+    }
+
+    // Collect results, finished workers, and kill those over the
+    // time limit
+    bool changed = false;
+    for (size_t i = 0; i < running.size(); i++) {
+      Worker& w = running[i];
+      size_t n_reported = w.n_reported;
+      ReadWorker(w);
+      ParseResults(w, models, results, n_done);
+      if (w.n_reported != n_reported) {
+        changed = true;
+      }
+
+      int wstatus;
+      pid_t ret = waitpid(w.pid, &wstatus, WNOHANG);
+      Number now = WallclockTime();
+      std::string failure;
+      if (ret == 0) {
+        if (time_limit > 0. && now - w.start > time_limit + grace) {
+          kill(w.pid, SIGKILL);
+          waitpid(w.pid, &wstatus, 0);
+          failure = "TIMEOUT";
+        }
+        else {
+          continue;
+        }
+      }
+      else {
+        ReadWorker(w);
+        ParseResults(w, models, results, n_done);
+        if (WIFSIGNALED(wstatus)) {
+          failure = "CRASHED";
+        }
+        else {
+          failure = "NO_RESULT";
+        }
+      }
+      close(w.fd);
+
+      // The entry the worker was busy with failed; the remaining
+      // entries are given to a new worker, which reads the stub with
+      // the options of the original first entry
+      const std::vector<size_t>& entries = w.job.entries;
+      if (w.n_reported < entries.size()) {
+        size_t idx = entries[w.n_reported];
+        results[idx].status = failure;
+        results[idx].total_wall_time = now - w.start;
+        PrintProgress(models, results, idx, ++n_done);
+        if (w.n_reported + 1 < entries.size()) {
+          BatchJob rest;
+          rest.entries.assign(entries.begin() + w.n_reported + 1,
+                              entries.end());
+          rest.read_entry = w.job.read_entry;
+          jobs.push_back(rest);
+        }
+      }
+      running.erase(running.begin() + i);
+      i--;
+      changed = true;
+    }
+    if (!changed && !running.empty()) {
+      usleep(10000);
+    }
+  }
+}
+#else
+/** Solve the jobs one after the other in this process. */
+static void SolveAll(const std::vector<BatchModel>& models,
+                     std::vector<BatchJob>& jobs,
+                     const std::string& options_file,
+                     const std::string& /*logdir*/,
+                     Number time_limit,
+                     Number /*grace*/,
+                     int /*n_workers*/,
+                     std::vector<BatchResult>& results)
+{
+  size_t n_done = 0;
+  for (size_t i = 0; i < jobs.size(); i++) {
+    SolveJob(models, jobs[i], options_file, "", time_limit, -1, results);
+    for (size_t k = 0; k < jobs[i].entries.size(); k++) {
+      PrintProgress(models, results, jobs[i].entries[k], ++n_done);
+    }
+  }
+}
+#endif
+
+/** Write the consolidated report as CSV. */
+static bool WriteReport(const std::string& fname,
+                        const std::vector<BatchModel>& models,
+                        const std::vector<BatchResult>& results)
+{
+  FILE* fp = stdout;
+  if (!fname.empty() && fname != "-") {
+    fp = fopen(fname.c_str(), "w");
+    if (!fp) {
+      return false;
+    }
+  }
+  fprintf(fp, "model,status,return_code,iterations,objective,"
+          "read_time,total_wall_time,solve_wall_time,solve_cpu_time,"
+          "obj_evals,con_evals,grad_evals,jac_evals,hess_evals\n");
+  for (size_t i = 0; i < models.size(); i++) {
+    const BatchResult& res = results[i];
+    fprintf(fp, "%s,%s,%d,%d,%.10e,%.6f,%.6f,%.6f,%.6f,%d,%d,%d,%d,%d\n",
+            models[i].stub.c_str(), res.status.c_str(), res.return_code,
+            res.iterations, res.objective, res.read_time, res.total_wall_time,
+            res.solve_wall_time, res.solve_cpu_time, res.n_obj,
+            res.n_con, res.n_grad, res.n_jac, res.n_hess);
+  }
+  if (fp != stdout) {
+    fclose(fp);
+  }
+  return true;
+}
+
+static void Usage(const char* prog)
+{
+  printf("Usage: %s [options] MANIFEST\n\n", prog);
+  printf("Options:\n");
+  printf("  -j N             number of worker processes (default 1)\n");
+  printf("  -time_limit SEC  wall clock limit per model (default none)\n");
+  printf("  -grace SEC       time after the limit before a worker is killed (default 5)\n");
+  printf("  -report FILE     write the CSV report to FILE (default stdout)\n");
+  printf("  -log DIR         write the solver output of each model to DIR\n");
+  printf("  -opt FILE        options file (default ipopt.opt)\n");
+  printf("  -no_reuse        read the stub again for every entry of the manifest\n");
+}
+
+int main(int argc, char** args)
+{
+  int n_workers = 1;
+  Number time_limit = -1.;
+  Number grace = 5.;
+  std::string report;
+  std::string logdir;
+  std::string options_file = "ipopt.opt";
+  std::string manifest;
+  bool reuse = true;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = args[i];
+    bool has_value = (i + 1 < argc);
+    if (arg == "-j" && has_value) {
+      n_workers = atoi(args[++i]);
+    }
+    else if (arg == "-time_limit" && has_value) {
+      time_limit = atof(args[++i]);
+    }
+    else if (arg == "-grace" && has_value) {
+      grace = atof(args[++i]);
+    }
+    else if (arg == "-report" && has_value) {
+      report = args[++i];
+    }
+    else if (arg == "-log" && has_value) {
+      logdir = args[++i];
+    }
+    else if (arg == "-opt" && has_value) {
+      options_file = args[++i];
+    }
+    else if (arg == "-no_reuse") {
+      reuse = false;
+    }
+    else if (arg[0] != '-' && manifest.empty()) {
+      manifest = arg;
+    }
+    else {
+      Usage(args[0]);
+      return -1;
+    }
+  }
+  if (manifest.empty() || n_workers < 1) {
+    Usage(args[0]);
+    return -1;
+  }
+
+  std::vector<BatchModel> models;
+  if (!ReadManifest(manifest, models)) {
+    printf("ipopt_batch: Cannot open manifest %s\n", manifest.c_str());
+    return -1;
+  }
+
+  std::vector<BatchResult> results(models.size());
+  for (size_t i = 0; i < results.size(); i++) {
+    InitResult(results[i]);
+  }
+
+  std::vector<BatchJob> jobs;
+  MakeJobs(models, reuse, jobs);
+
+  Number start = WallclockTime();
+  SolveAll(models, jobs, options_file, logdir, time_limit, grace, n_workers,
+           results);
+  Number total = WallclockTime() - start;
+
+  Index n_success = 0;
+  for (size_t i = 0; i < results.size(); i++) {
+    if (results[i].return_code == Solve_Succeeded ||
+        results[i].return_code == Solved_To_Acceptable_Level) {
+      n_success++;
+    }
+  }
+  printf("\nSolved %d of %d models in %.3f seconds.\n",
+         n_success, (int)models.size(), total);
+
+  if (!WriteReport(report, models, results)) {
+    printf("ipopt_batch: Cannot write report %s\n", report.c_str());
+    return -1;
+  }
+
+  return 0;
+}
@@ -9,6 +9,7 @@
 #include "IpoptConfig.h"
 #include "IpJournalist.hpp"
 #include "IpDebug.hpp"
+#include "IpUtils.hpp"
 
 #ifdef HAVE_CSTDIO
 # include <cstdio>
@@ -266,6 +267,32 @@ namespace Ipopt
     }
   }
 
+  void Journalist::FinalFlush() const
+  {
+    for (Index i=0; i<(Index)journals_.size(); i++) {
+      journals_[i]->FinalFlush();
+    }
+  }
+
+  SmartPtr<Journal> Journalist::AddBufferedFileJournal(
+    const std::string& journal_name,
+    const std::string& fname,
+    EJournalLevel default_level,
+    Index buffer_size,
+    Number flush_interval,
+    bool drop_when_full
+  )
+  {
+    SmartPtr<BufferedFileJournal> temp =
+      new BufferedFileJournal(journal_name, default_level, buffer_size,
+                              flush_interval, drop_when_full);
+
+    if (temp->Open(fname.c_str()) && AddJournal(GetRawPtr(temp))) {
+      return GetRawPtr(temp);
+    }
+    return NULL;
+  }
+
   SmartPtr<Journal> Journalist::GetJournal(
     const std::string& journal_name
   )
@@ -425,6 +452,166 @@ namespace Ipopt
   }
 
 
+  ///////////////////////////////////////////////////////////////////////////
+  //             Implementation of the BufferedFileJournal class           //
+  ///////////////////////////////////////////////////////////////////////////
+
+  BufferedFileJournal::BufferedFileJournal(
+    const std::string& name,
+    EJournalLevel default_level,
+    Index buffer_size,
+    Number flush_interval,
+    bool drop_when_full
+  )
+      :
+      Journal(name, default_level),
+      file_(NULL),
+      buffer_(NULL),
+      buffer_size_(buffer_size),
+      used_(0),
+      flush_interval_(flush_interval),
+      last_write_time_(0.),
+      drop_when_full_(drop_when_full),
+      dropped_(0)
+  {
+    DBG_ASSERT(buffer_size_ > 0);
+    buffer_ = new char[buffer_size_];
+  }
+
+  BufferedFileJournal::~BufferedFileJournal()
+  {
+    Close();
+    delete [] buffer_;
+  }
+
+  void BufferedFileJournal::Close()
+  {
+    WriteBuffer();
+    if (file_ && file_ != stdout && file_ != stderr) {
+      // close the file
+      fclose(file_);
+    }
+    file_ = NULL;
+  }
+
+  bool BufferedFileJournal::Open(const char* fname)
+  {
+    Close();
+
+    if (strcmp("stdout", fname)==0) {
+      file_=stdout;
+    }
+    else if (strcmp("stderr", fname)==0) {
+      file_=stderr;
+    }
+    else {
+      // open the file on disk
+      file_ = fopen(fname, "w+");
+    }
+    last_write_time_ = WallclockTime();
+
+    return file_ != NULL;
+  }
+
+  void BufferedFileJournal::WriteBuffer()
+  {
+    if (!file_) {
+      used_ = 0;
+      dropped_ = 0;
+      return;
+    }
+    if (used_ > 0) {
+      fwrite(buffer_, 1, used_, file_);
+      used_ = 0;
+    }
+    if (dropped_ > 0) {
+      fprintf(file_, "\n[%d messages dropped since the output buffer was full]\n",
+              dropped_);
+      dropped_ = 0;
+    }
+    fflush(file_);
+    last_write_time_ = WallclockTime();
+  }
+
+  void BufferedFileJournal::PrintImpl(EJournalCategory category,
+                                      EJournalLevel level, const char* str)
+  {
+    DBG_START_METH("BufferedFileJournal::PrintImpl", 0);
+    if (!file_) {
+      return;
+    }
+    Index len = (Index)strlen(str);
+    if (len > buffer_size_ - used_) {
+      if (drop_when_full_) {
+        dropped_++;
+        return;
+      }
+      WriteBuffer();
+      if (len > buffer_size_) {
+        // Message does not fit into the empty buffer
+        fputs(str, file_);
+        return;
+      }
+    }
+    memcpy(buffer_ + used_, str, len);
+    used_ += len;
+  }
+
+  void BufferedFileJournal::PrintfImpl(EJournalCategory category,
+                                       EJournalLevel level,
+                                       const char* pformat, va_list ap)
+  {
+    DBG_START_METH("BufferedFileJournal::PrintfImpl", 0);
+    if (!file_) {
+      return;
+    }
+#if defined(HAVE_VA_COPY) && (defined(HAVE_VSNPRINTF) || defined(HAVE__VSNPRINTF))
+    // Format directly into the free part of the buffer.  If the
+    // message does not fit, it is formatted again from a copy of the
+    // arguments after the buffer has been written.
+    va_list apcopy;
+    va_copy(apcopy, ap);
+    Index avail = buffer_size_ - used_;
+# ifdef HAVE_VSNPRINTF
+    int len = vsnprintf(buffer_ + used_, avail, pformat, ap);
+# else
+    int len = _vsnprintf(buffer_ + used_, avail, pformat, ap);
+# endif
+    // Note that _vsnprintf returns a negative number if the message is
+    // too long
+    if (len >= 0 && len < avail) {
+      used_ += len;
+    }
+    else if (drop_when_full_) {
+      dropped_++;
+    }
+    else {
+      WriteBuffer();
+      vfprintf(file_, pformat, apcopy);
+    }
+    va_end(apcopy);
+#else
+    // Without vsnprintf and va_copy, the message cannot be formatted
+    // into the buffer safely
+    WriteBuffer();
+    vfprintf(file_, pformat, ap);
+#endif
+  }
+
+  void BufferedFileJournal::FlushBufferImpl()
+  {
+    if (file_ && (used_ > 0 || dropped_ > 0) &&
+        WallclockTime() - last_write_time_ >= flush_interval_) {
+      WriteBuffer();
+    }
+  }
+
+  void BufferedFileJournal::FinalFlush()
+  {
+    WriteBuffer();
+  }
+
+
   ///////////////////////////////////////////////////////////////////////////
   //                 Implementation of the StreamJournal class               //
   ///////////////////////////////////////////////////////////////////////////
@@ -199,6 +199,12 @@ namespace Ipopt
      cluttering output with that produced by other parts of the
      program (e.g. written in Fortran) */
     virtual void FlushBuffer() const;
+
+    /** Method that writes out all output of all Journals, including
+     *  output that Journals with internal buffers defer in
+     *  FlushBuffer.  This is called at the end of an optimization
+     *  run. */
+    virtual void FinalFlush() const;
     //@}
 
     /**@name Reader Methods.
@@ -234,6 +240,20 @@ namespace Ipopt
       EJournalLevel default_level = J_WARNING  /**< default journal level */
     );
 
+    /** Add a new BufferedFileJournal.  The arguments are the same as
+     *  for AddFileJournal; the remaining arguments are passed to the
+     *  constructor of BufferedFileJournal.  It returns NULL if there
+     *  was a problem creating a new Journal.
+     */
+    virtual SmartPtr<Journal> AddBufferedFileJournal(
+      const std::string& location_name,        /**< journal identifier */
+      const std::string& fname,                /**< file name */
+      EJournalLevel default_level,             /**< default journal level */
+      Index buffer_size,                       /**< buffer size in bytes */
+      Number flush_interval,                   /**< see BufferedFileJournal */
+      bool drop_when_full                      /**< see BufferedFileJournal */
+    );
+
     /** Get an existing journal.  You can use this method to change
      *  the acceptance criteria at runtime.
      */
@@ -326,6 +346,13 @@ namespace Ipopt
     {
       FlushBufferImpl();
     }
+
+    /** Write out all output, also if the journal would defer it in
+     *  FlushBuffer.  By default, this is the same as FlushBuffer. */
+    virtual void FinalFlush()
+    {
+      FlushBuffer();
+    }
     //@}
 
   protected:
@@ -434,6 +461,119 @@ namespace Ipopt
     FILE* file_;
   };
 
+  /** BufferedFileJournal class. This is a Journal implementation that
+   *  writes to a file (or stdout, stderr) like the FileJournal, but
+   *  formats the messages into an internal buffer of fixed size that
+   *  is written to the file with a single fwrite when it is full, or
+   *  when FlushBuffer is called at least flush_interval seconds after
+   *  the last write (FlushBuffer is called once per iteration, and a
+   *  flush_interval of 0 writes the buffer at every such call).
+   *  FinalFlush always writes the buffer.  This reduces the number of
+   *  calls into the C library and of flushes of the file, which can be
+   *  expensive on slow (e.g., network) file systems.
+   *
+   *  The memory used by the journal is bounded by the buffer size.  If
+   *  drop_when_full is true, a message that does not fit into the
+   *  buffer any more is dropped instead of writing the buffer, so that
+   *  file I/O is only done at the times described above.  The number
+   *  of dropped messages is noted in the file at the next write.
+   */
+  class BufferedFileJournal : public Journal
+  {
+  public:
+    /** Constructor. */
+    BufferedFileJournal(const std::string& name, EJournalLevel default_level,
+                        Index buffer_size, Number flush_interval,
+                        bool drop_when_full);
+
+    /** Destructor.  Writes out the buffer. */
+    virtual ~BufferedFileJournal();
+
+    /** Open a new file for the output location.
+     *  Special Names: stdout means stdout,
+     *               : stderr means stderr.
+     *
+     *  Return code is false only if the file with the given name
+     *  could not be opened.
+     */
+    virtual bool Open(const char* fname);
+
+    /** Write out the buffer, regardless of the flush interval */
+    virtual void FinalFlush();
+
+    /** Number of messages dropped since the last write */
+    Index DroppedMessages() const
+    {
+      return dropped_;
+    }
+
+  protected:
+    /**@name Implementation version of Print methods - Overloaded from
+     * Journal base class.
+     */
+    //@{
+    /** Print to the designated output location */
+    virtual void PrintImpl(EJournalCategory category, EJournalLevel level,
+                           const char* str);
+
+    /** Printf to the designated output location */
+    virtual void PrintfImpl(EJournalCategory category, EJournalLevel level,
+                            const char* pformat, va_list ap);
+
+    /** Flush output buffer, if the flush interval has passed.*/
+    virtual void FlushBufferImpl();
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and 
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    BufferedFileJournal();
+
+    /** Copy Constructor */
+    BufferedFileJournal(const BufferedFileJournal&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const BufferedFileJournal&);
+    //@}
+
+    /** Write the buffer to the file and flush the file */
+    void WriteBuffer();
+
+    /** Close the file, if it is not stdout or stderr */
+    void Close();
+
+    /** FILE pointer for the output destination */
+    FILE* file_;
+
+    /** Buffer for the formatted messages */
+    char* buffer_;
+
+    /** Size of buffer_ */
+    Index buffer_size_;
+
+    /** Number of bytes used in buffer_ */
+    Index used_;
+
+    /** Minimal time in seconds between two writes in FlushBuffer */
+    Number flush_interval_;
+
+    /** Wallclock time of the last write */
+    Number last_write_time_;
+
+    /** Whether messages are dropped if the buffer is full */
+    bool drop_when_full_;
+
+    /** Number of messages dropped since the last write */
+    Index dropped_;
+  };
+
   /** StreamJournal class. This is a particular Journal implementation that
    *  writes to a stream for output.
    */
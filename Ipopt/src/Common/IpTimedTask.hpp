@@ -11,10 +11,26 @@
 
 #include "IpUtils.hpp"
 
+#include <vector>
+#include <utility>
+
 namespace Ipopt
 {
   /** This class is used to collect timing information for a
-   *  particular task. */
+   *  particular task.
+   *
+   *  The wall clock time is always measured (with a monotonic clock,
+   *  if available), together with the number of calls and the
+   *  shortest and longest duration of a single call.  Measuring the
+   *  CPU and system time requires a query of the resource usage of
+   *  the process at the beginning and the end of every call, which is
+   *  comparatively expensive for tasks that are executed very often.
+   *  It can therefore be switched off with SetMeasureCpuTime.
+   *
+   *  If tracing is enabled, the start time and the duration of every
+   *  call are recorded as well, so that the nested calls of all tasks
+   *  can be written as a timeline (see
+   *  TimingStatistics::WriteTraceFile). */
   class TimedTask
   {
   public:
@@ -23,9 +39,15 @@ namespace Ipopt
     /** Default constructor. */
     TimedTask()
         :
+        name_(""),
         total_cputime_(0.),
         total_systime_(0.),
         total_walltime_(0.),
+        min_walltime_(0.),
+        max_walltime_(0.),
+        n_calls_(0),
+        measure_cputime_(true),
+        trace_(false),
         start_called_(false),
         end_called_(true)
     {}
@@ -41,6 +63,10 @@ namespace Ipopt
       total_cputime_ = 0.;
       total_systime_ = 0.;
       total_walltime_ = 0.;
+      min_walltime_ = 0.;
+      max_walltime_ = 0.;
+      n_calls_ = 0;
+      trace_events_.clear();
       start_called_ = false;
       end_called_ = true;
     }
@@ -52,8 +78,9 @@ namespace Ipopt
       DBG_ASSERT(!start_called_);
       end_called_ = false;
       start_called_ = true;
-      start_cputime_ = CpuTime();
-      start_systime_ = SysTime();
+      if (measure_cputime_) {
+        CpuAndSysTime(start_cputime_, start_systime_);
+      }
       start_walltime_ = WallclockTime();
     }
 
@@ -62,11 +89,7 @@ namespace Ipopt
     {
       DBG_ASSERT(!end_called_);
       DBG_ASSERT(start_called_);
-      end_called_ = true;
-      start_called_ = false;
-      total_cputime_ += CpuTime() - start_cputime_;
-      total_systime_ += SysTime() - start_systime_;
-      total_walltime_ += WallclockTime() - start_walltime_;
+      Stop();
     }
 
     /** Method that is called after execution of the task for which
@@ -76,11 +99,7 @@ namespace Ipopt
     void EndIfStarted()
     {
       if (start_called_) {
-        end_called_ = true;
-        start_called_ = false;
-        total_cputime_ += CpuTime() - start_cputime_;
-        total_systime_ += SysTime() - start_systime_;
-        total_walltime_ += WallclockTime() - start_walltime_;
+        Stop();
       }
       DBG_ASSERT(end_called_);
     }
@@ -106,6 +125,66 @@ namespace Ipopt
       return total_walltime_;
     }
 
+    /** Method returning the number of completed calls of the task. */
+    Index NumberOfCalls() const
+    {
+      return n_calls_;
+    }
+
+    /** Method returning the shortest wall clock time of a single call
+     *  (zero if the task has not been executed). */
+    Number MinWallclockTime() const
+    {
+      return min_walltime_;
+    }
+
+    /** Method returning the longest wall clock time of a single call
+     *  (zero if the task has not been executed). */
+    Number MaxWallclockTime() const
+    {
+      return max_walltime_;
+    }
+
+    /** @name Name of the task (used for output and traces).  The
+     *  string is not copied and must persist. */
+    //@{
+    void SetName(const char* name)
+    {
+      name_ = name;
+    }
+    const char* Name() const
+    {
+      return name_;
+    }
+    //@}
+
+    /** Method for switching the measurement of CPU and system time
+     *  on or off.  If it is off, the CPU and system times are not
+     *  updated. */
+    void SetMeasureCpuTime(bool measure_cputime)
+    {
+      DBG_ASSERT(end_called_);
+      measure_cputime_ = measure_cputime;
+    }
+
+    /** Method for switching the recording of the individual calls on
+     *  or off. */
+    void SetTrace(bool trace)
+    {
+      trace_ = trace;
+      if (!trace_) {
+        trace_events_.clear();
+      }
+    }
+
+    /** Recorded calls, given by pairs of the wall clock time at the
+     *  start of the call and its duration (only if tracing is
+     *  switched on). */
+    const std::vector<std::pair<Number, Number> >& TraceEvents() const
+    {
+      return trace_events_;
+    }
+
   private:
     /**@name Default Compiler Generated Methods (Hidden to avoid
      * implicit creation/calling).  These methods are not
@@ -121,6 +200,35 @@ namespace Ipopt
     void operator=(const TimedTask&);
     //@}
 
+    /** Update the statistics at the end of a call. */
+    void Stop()
+    {
+      Number walltime = WallclockTime() - start_walltime_;
+      if (measure_cputime_) {
+        Number cputime;
+        Number systime;
+        CpuAndSysTime(cputime, systime);
+        total_cputime_ += cputime - start_cputime_;
+        total_systime_ += systime - start_systime_;
+      }
+      total_walltime_ += walltime;
+      if (n_calls_ == 0 || walltime < min_walltime_) {
+        min_walltime_ = walltime;
+      }
+      if (walltime > max_walltime_) {
+        max_walltime_ = walltime;
+      }
+      n_calls_++;
+      if (trace_) {
+        trace_events_.push_back(std::make_pair(start_walltime_, walltime));
+      }
+      end_called_ = true;
+      start_called_ = false;
+    }
+
+    /** Name of the task */
+    const char* name_;
+
     /** CPU time at beginning of task. */
     Number start_cputime_;
     /** Total CPU time for task measured so far. */
@@ -133,6 +241,19 @@ namespace Ipopt
     Number start_walltime_;
     /** Total wall clock time for task measured so far. */
     Number total_walltime_;
+    /** Shortest wall clock time of a single call. */
+    Number min_walltime_;
+    /** Longest wall clock time of a single call. */
+    Number max_walltime_;
+    /** Number of completed calls. */
+    Index n_calls_;
+
+    /** Flag indicating whether CPU and system time are measured. */
+    bool measure_cputime_;
+    /** Flag indicating whether the individual calls are recorded. */
+    bool trace_;
+    /** Start time and duration of the recorded calls. */
+    std::vector<std::pair<Number, Number> > trace_events_;
 
     /** @name fields for debugging */
     //@{
@@ -138,9 +138,20 @@ inline double IpCoinGetTimeOfDay()
 #else
 
 #include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
 
 inline double IpCoinGetTimeOfDay()
 {
+#if defined(_POSIX_TIMERS) && _POSIX_TIMERS > 0 && defined(CLOCK_MONOTONIC)
+  // use the monotonic clock if available; it is not affected by
+  // adjustments of the system time and usually read without a system
+  // call
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+    return static_cast<double>(ts.tv_sec) + static_cast<double>(ts.tv_nsec)/1000000000.0;
+  }
+#endif
   struct timeval tv;
   gettimeofday(&tv, NULL);
   return static_cast<double>(tv.tv_sec) + static_cast<double>(tv.tv_usec)/1000000.0;
@@ -250,6 +261,22 @@ namespace Ipopt
     return sys_temp;
   }
 
+  void CpuAndSysTime(Number& cpu_time, Number& sys_time)
+  {
+#if defined(_MSC_VER) || defined(__MSVCRT__)
+    cpu_time = CpuTime();
+    sys_time = SysTime();
+#else
+
+    struct rusage usage;
+    getrusage(RUSAGE_SELF,&usage);
+    cpu_time = (double)usage.ru_utime.tv_sec;
+    cpu_time += 1.0e-6*((double) usage.ru_utime.tv_usec);
+    sys_time = (double)usage.ru_stime.tv_sec;
+    sys_time += 1.0e-6*((double) usage.ru_stime.tv_usec);
+#endif
+  }
+
   Number WallclockTime()
   {
     double callTime = IpCoinGetTimeOfDay();
@@ -110,7 +110,12 @@ namespace Ipopt
   /** method determining system time */
   Number SysTime();
 
-  /** method determining wallclock time since first call */
+  /** method determining CPU time and system time with a single
+   *  query of the resource usage */
+  void CpuAndSysTime(Number& cpu_time, Number& sys_time);
+
+  /** method determining wallclock time since first call.  A
+   *  monotonic clock is used if the system provides one. */
   Number WallclockTime();
 
   /** Method for comparing two numbers within machine precision.  The
@@ -23,6 +23,7 @@ namespace Ipopt
     SUCCESS,
     MAXITER_EXCEEDED,
     CPUTIME_EXCEEDED,
+    WALLTIME_EXCEEDED,
     STOP_AT_TINY_STEP,
     STOP_AT_ACCEPTABLE_POINT,
     LOCAL_INFEASIBILITY,
@@ -46,6 +47,7 @@ namespace Ipopt
   DECLARE_STD_EXCEPTION(TOO_FEW_DOF);
   DECLARE_STD_EXCEPTION(TINY_STEP_DETECTED);
   DECLARE_STD_EXCEPTION(ACCEPTABLE_POINT_REACHED);
+  DECLARE_STD_EXCEPTION(WALLTIME_LIMIT_REACHED);
   DECLARE_STD_EXCEPTION(FEASIBILITY_PROBLEM_SOLVED);
   DECLARE_STD_EXCEPTION(INVALID_WARMSTART);
   DECLARE_STD_EXCEPTION(INTERNAL_ABORT);
@@ -20,6 +20,8 @@
 #include "IpAlgorithmRegOp.hpp"
 #include "IpCGPenaltyRegOp.hpp"
 #include "IpNLPBoundsRemover.hpp"
+#include "IpTNLPDecomposition.hpp"
+#include "IpWarmStartCache.hpp"
 
 #ifdef COIN_HAS_HSL
 #include "CoinHslConfig.h"
@@ -224,15 +226,21 @@ namespace Ipopt
           options_to_print.push_back("print_frequency_time");
           options_to_print.push_back("output_file");
           options_to_print.push_back("file_print_level");
+          options_to_print.push_back("output_file_buffer_size");
+          options_to_print.push_back("output_file_flush_interval");
+          options_to_print.push_back("output_file_drop_when_full");
           options_to_print.push_back("option_file_name");
           options_to_print.push_back("print_info_string");
           options_to_print.push_back("inf_pr_output");
           options_to_print.push_back("print_timing_statistics");
+          options_to_print.push_back("timing_statistics");
+          options_to_print.push_back("timing_trace_file");
 
           options_to_print.push_back("#Termination");
           options_to_print.push_back("tol");
           options_to_print.push_back("max_iter");
           options_to_print.push_back("max_cpu_time");
+          options_to_print.push_back("max_wall_time");
           options_to_print.push_back("dual_inf_tol");
           options_to_print.push_back("constr_viol_tol");
           options_to_print.push_back("compl_inf_tol");
@@ -614,6 +622,33 @@ namespace Ipopt
       "NOTE: This option only works when read from the ipopt.opt options file! "
       "Determines the verbosity level for the file specified by "
       "\"output_file\".  By default it is the same as \"print_level\".");
+    roptions->AddLowerBoundedIntegerOption(
+      "output_file_buffer_size",
+      "Size of the buffer for the output file in bytes.",
+      0, 0,
+      "If positive, the output for the file specified by \"output_file\" "
+      "is collected in a buffer of this size and written in larger blocks: "
+      "when the buffer is full, when \"output_file_flush_interval\" "
+      "seconds have passed at the end of an iteration, and at the end of "
+      "the optimization.  If 0, the output is written directly.");
+    roptions->AddLowerBoundedNumberOption(
+      "output_file_flush_interval",
+      "Minimal time between two writes of the output file buffer.",
+      0., false, 1.,
+      "Wallclock time in seconds that has to pass before the output file "
+      "buffer is written at the end of an iteration.  "
+      "Only used if \"output_file_buffer_size\" is positive.");
+    roptions->AddStringOption2(
+      "output_file_drop_when_full",
+      "Drop output if the output file buffer is full.",
+      "no",
+      "no", "write the buffer to the file when it is full",
+      "yes", "drop messages that do not fit into the buffer",
+      "With \"yes\", the file is only written at the times determined by "
+      "\"output_file_flush_interval\" and at the end of the optimization, "
+      "and the memory for the output is bounded by "
+      "\"output_file_buffer_size\"; the number of dropped messages is noted "
+      "in the file.  Only used if \"output_file_buffer_size\" is positive.");
     roptions->AddStringOption2(
       "print_user_options",
       "Print all options set by the user.",
@@ -654,7 +689,28 @@ namespace Ipopt
       "no", "don't print statistics",
       "yes", "print all timing statistics",
       "If selected, the program will print the CPU usage (user time) for "
-      "selected tasks.");
+      "selected tasks, as well as the number of calls and the wall clock "
+      "time per call.  This implies timing_statistics=yes.");
+    roptions->AddStringOption2(
+      "timing_statistics",
+      "Indicates whether to measure the CPU time of all timed tasks.",
+      "no",
+      "no", "measure only the wall clock time of the individual tasks",
+      "yes", "measure CPU, system, and wall clock time of all tasks",
+      "The wall clock time of the tasks is always measured.  Measuring the "
+      "CPU and system time of a task requires additional system calls for "
+      "every execution of the task, which can be noticeable for small "
+      "problems.  The CPU time of the overall algorithm is always measured.");
+    roptions->AddStringOption1(
+      "timing_trace_file",
+      "File name for a trace of the timed tasks.",
+      "",
+      "*", "Any acceptable standard file name",
+      "If a file name is given, the start time and duration of every call "
+      "of the timed tasks is recorded and written to this file in the "
+      "Trace Event Format after the optimization, so that the nesting of "
+      "the tasks can be inspected in a trace viewer (e.g., chrome://tracing).  "
+      "The memory required for the trace grows with every call of a task.");
 
     roptions->AddStringOption1(
       "option_file_name",
@@ -683,6 +739,54 @@ namespace Ipopt
       "FinalizeSolution method separately.  Setting this option to \"yes\" "
       "will cause the IpoptApplication object to suppress the default call to "
       "that method.");
+    roptions->AddStringOption2(
+      "decompose_independent_blocks",
+      "Indicates if independent subproblems should be solved separately.", "no",
+      "no", "solve the problem as a whole",
+      "yes", "solve each independent block as a separate problem",
+      "If selected, the sparsity structure of the constraint Jacobian and of "
+      "the Hessian of the Lagrangian is analyzed before the optimization.  If "
+      "the problem consists of several groups of variables and constraints "
+      "that are not coupled with each other, each group is solved as a "
+      "separate problem, and the solutions are combined before they are "
+      "passed to finalize_solution.  This requires that the TNLP provides the "
+      "structure of the Hessian (eval_h), and it is only used for problems "
+      "given as TNLP.  The Ipopt objects of the individual runs are not kept, "
+      "so that ReOptimizeTNLP cannot be used after a decomposed solve.  "
+      "Note that the arguments ip_data and ip_cq of finalize_solution are "
+      "NULL for a decomposed solve, since there are no such objects for the "
+      "complete problem.");
+    roptions->AddLowerBoundedIntegerOption(
+      "decompose_min_block_size",
+      "Minimal size of an independent block that is solved separately.",
+      1, 100,
+      "If \"decompose_independent_blocks\" is chosen, all independent blocks "
+      "with fewer variables and constraints than this value are combined "
+      "and solved together as one problem, since the overhead of a separate "
+      "optimization run outweighs its benefit for small blocks (such as "
+      "single free variables).  If this leaves only one block, the problem is "
+      "solved as a whole.");
+
+    roptions->SetRegisteringCategory("Warm Start");
+    roptions->AddLowerBoundedIntegerOption(
+      "warm_start_cache_size",
+      "Maximal number of solutions kept for parametric warm starts.",
+      1, 10,
+      "Determines how many solutions are stored by "
+      "IpoptApplication::OptimizeParametricTNLP.  If the cache is full, the "
+      "least recently used solution is replaced.  The value is read when the "
+      "cache is created by the first call of OptimizeParametricTNLP.");
+    roptions->AddLowerBoundedNumberOption(
+      "warm_start_cache_mu_factor",
+      "Factor for the barrier parameter stored with a cached solution.",
+      0., false, 1e3,
+      "The barrier parameter at the end of a run of "
+      "IpoptApplication::OptimizeParametricTNLP is close to zero, which is "
+      "too small as initial value for a problem with different parameters, "
+      "since the cached solution is then not optimal and the iterates would "
+      "stay too close to the bounds.  Therefore, the final barrier parameter is "
+      "multiplied by this factor, and at least \"mu_min\" is stored as the "
+      "value of \"mu_init\" for later warm starts from this solution.");
 
     roptions->SetRegisteringCategory("Undocumented");
     roptions->AddStringOption2(
@@ -711,6 +815,18 @@ namespace Ipopt
   ApplicationReturnStatus
   IpoptApplication::OptimizeTNLP(const SmartPtr<TNLP>& tnlp)
   {
+    bool decompose;
+    options_->GetBoolValue("decompose_independent_blocks", decompose, "");
+    if (decompose) {
+      Index min_block_size;
+      options_->GetIntegerValue("decompose_min_block_size", min_block_size,
+                                "");
+      SmartPtr<TNLPDecomposition> decomp = new TNLPDecomposition(*tnlp);
+      if (decomp->Analyze(min_block_size) > 1) {
+        return call_optimize_decomposed(*decomp);
+      }
+    }
+
     nlp_adapter_ = new TNLPAdapter(GetRawPtr(tnlp), ConstPtr(jnlst_));
     return OptimizeNLP(nlp_adapter_);
   }
@@ -723,12 +839,147 @@ namespace Ipopt
     TNLPAdapter* adapter =
       static_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_));
     DBG_ASSERT(dynamic_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_)));
-    ASSERT_EXCEPTION(adapter->tnlp()==tnlp, INVALID_WARMSTART,
-                     "ReOptimizeTNLP called for different TNLP.")
+    if (adapter->tnlp() != tnlp) {
+      // With warm_start_same_structure, the sparsity structure and the
+      // partitioning of the variables and constraints are reused, so
+      // that they must be the same for the new problem
+      bool warm_start_same_structure;
+      options_->GetBoolValue("warm_start_same_structure",
+                             warm_start_same_structure, "");
+      ASSERT_EXCEPTION(!warm_start_same_structure ||
+                       adapter->HasSameStructure(tnlp), INVALID_WARMSTART,
+                       "warm_start_same_structure chosen, but the new TNLP has a different structure.");
+      // Reuse the algorithm objects for the new problem
+      adapter->SetTNLP(tnlp);
+    }
 
     return ReOptimizeNLP(nlp_adapter_);
   }
 
+  ApplicationReturnStatus
+  IpoptApplication::OptimizeTNLPBatch(const std::vector<SmartPtr<TNLP> >& tnlps,
+                                      std::vector<ApplicationReturnStatus>& status,
+                                      std::vector<SmartPtr<SolveStatistics> >& statistics)
+  {
+    const Index nprob = (Index)tnlps.size();
+    status.resize(nprob);
+    statistics.resize(nprob);
+
+    ApplicationReturnStatus retValue = Solve_Succeeded;
+    // Flag indicating whether the algorithm objects of the previous
+    // run have been set up completely and can be reused
+    bool reusable = false;
+    for (Index i=0; i<nprob; i++) {
+      // Each run creates a new statistics object, unless it fails
+      // before the optimization is started
+      statistics_ = NULL;
+
+      bool same_structure = false;
+      if (reusable && IsValid(nlp_adapter_)) {
+        TNLPAdapter* adapter =
+          static_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_));
+        DBG_ASSERT(dynamic_cast<TNLPAdapter*> (GetRawPtr(nlp_adapter_)));
+        same_structure = adapter->HasSameStructure(tnlps[i]);
+      }
+
+      if (same_structure) {
+        jnlst_->Printf(J_DETAILED, J_MAIN,
+                       "\nSolving problem %d of %d in batch, reusing the structure of the previous problem.\n", i+1, nprob);
+        // Keep the vector spaces, the KKT structure and the symbolic
+        // factorization of the previous run; the option is reset
+        // afterwards so that a later call starts from scratch
+        std::string same_structure_value;
+        options_->GetStringValue("warm_start_same_structure",
+                                 same_structure_value, "");
+        options_->SetStringValue("warm_start_same_structure", "yes");
+        try {
+          status[i] = ReOptimizeTNLP(tnlps[i]);
+        }
+        catch (...) {
+          options_->SetStringValue("warm_start_same_structure",
+                                   same_structure_value);
+          throw;
+        }
+        options_->SetStringValue("warm_start_same_structure",
+                                 same_structure_value);
+      }
+      else {
+        jnlst_->Printf(J_DETAILED, J_MAIN,
+                       "\nSolving problem %d of %d in batch.\n", i+1, nprob);
+        status[i] = OptimizeTNLP(tnlps[i]);
+      }
+      statistics[i] = Statistics();
+      reusable = (status[i] > Not_Enough_Degrees_Of_Freedom ||
+                  status[i] == Invalid_Number_Detected);
+      if (retValue == Solve_Succeeded && status[i] != Solve_Succeeded) {
+        retValue = status[i];
+      }
+    }
+
+    return retValue;
+  }
+
+  ApplicationReturnStatus
+  IpoptApplication::OptimizeParametricTNLP(const SmartPtr<TNLP>& tnlp,
+      const std::vector<Number>& parameters)
+  {
+    if (IsNull(warm_start_cache_)) {
+      Index cache_size;
+      options_->GetIntegerValue("warm_start_cache_size", cache_size, "");
+      warm_start_cache_ = new WarmStartCache(cache_size);
+    }
+
+    Index n, m, nnz_jac_g, nnz_h_lag;
+    TNLP::IndexStyleEnum index_style;
+    if (!tnlp->get_nlp_info(n, m, nnz_jac_g, nnz_h_lag, index_style)) {
+      // Let the regular solve report the problem
+      return OptimizeTNLP(tnlp);
+    }
+
+    SmartPtr<TNLPAdapter> adapter =
+      new TNLPAdapter(GetRawPtr(tnlp), ConstPtr(jnlst_));
+    adapter->SetKeepSolution(true);
+    nlp_adapter_ = GetRawPtr(adapter);
+
+    // The warm start options are only changed for this run
+    OptionsList saved_options;
+    saved_options = *options_;
+
+    std::vector<Number> x;
+    std::vector<Number> z_L;
+    std::vector<Number> z_U;
+    std::vector<Number> lambda;
+    Number mu;
+    Number distance;
+    if (warm_start_cache_->FindNearest(parameters, n, m, x, z_L, z_U,
+                                       lambda, mu, distance)) {
+      jnlst_->Printf(J_DETAILED, J_MAIN,
+                     "\nStarting from cached solution with parameter distance %e and mu = %e.\n",
+                     distance, mu);
+      adapter->SetStartingPoint(x, z_L, z_U, lambda);
+      options_->SetStringValue("warm_start_init_point", "yes");
+      options_->SetNumericValue("mu_init", mu);
+    }
+
+    ApplicationReturnStatus retValue = OptimizeNLP(nlp_adapter_);
+    *options_ = saved_options;
+
+    if ((retValue == Solve_Succeeded ||
+         retValue == Solved_To_Acceptable_Level) &&
+        adapter->GetSolution(x, z_L, z_U, lambda)) {
+      // The final mu is scaled up, since the next problem starts from
+      // a point that is not optimal for it
+      Number mu_factor;
+      options_->GetNumericValue("warm_start_cache_mu_factor", mu_factor, "");
+      Number mu_min;
+      options_->GetNumericValue("mu_min", mu_min, "");
+      Number mu_stored = Max(mu_factor*ip_data_->curr_mu(), mu_min);
+      warm_start_cache_->Store(parameters, x, z_L, z_U, lambda, mu_stored);
+    }
+
+    return retValue;
+  }
+
   ApplicationReturnStatus
   IpoptApplication::OptimizeNLP(const SmartPtr<NLP>& nlp)
   {
@@ -799,7 +1050,7 @@ namespace Ipopt
       }
     }
 
-    jnlst_->FlushBuffer();
+    jnlst_->FinalFlush();
 
     return retValue;
   }
@@ -865,6 +1116,13 @@ namespace Ipopt
       bool print_timing_statistics;
       options_->GetBoolValue("print_timing_statistics",
                              print_timing_statistics, "");
+      bool timing_statistics;
+      options_->GetBoolValue("timing_statistics", timing_statistics, "");
+      std::string timing_trace_file;
+      options_->GetStringValue("timing_trace_file", timing_trace_file, "");
+      p2ip_data->TimingStats().SetMeasureCpuTimes(timing_statistics ||
+          print_timing_statistics);
+      p2ip_data->TimingStats().SetTrace(!timing_trace_file.empty());
 
       // If selected, print the user options
       bool print_user_options;
@@ -978,6 +1236,14 @@ namespace Ipopt
         p2ip_nlp->PrintTimingStatistics(*jnlst_, J_SUMMARY,
                                         J_TIMING_STATISTICS);
       }
+      if (!timing_trace_file.empty()) {
+        if (!p2ip_data->TimingStats().WriteTraceFile(timing_trace_file)) {
+          jnlst_->Printf(J_WARNING, J_MAIN,
+                         "\nWARNING: Could not write timing trace to file \"%s\".\n",
+                         timing_trace_file.c_str());
+        }
+        p2ip_data->TimingStats().SetTrace(false);
+      }
 
       // Write EXIT message
       if (status == SUCCESS) {
@@ -992,6 +1258,10 @@ namespace Ipopt
         retValue = Maximum_CpuTime_Exceeded;
         jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Maximum CPU time exceeded.\n");
       }
+      else if (status == WALLTIME_EXCEEDED) {
+        retValue = Maximum_WallTime_Exceeded;
+        jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Maximum wallclock time exceeded.\n");
+      }
       else if (status == STOP_AT_TINY_STEP) {
         retValue = Search_Direction_Becomes_Too_Small;
         jnlst_->Printf(J_SUMMARY, J_MAIN, "\nEXIT: Search Direction is becoming Too Small.\n");
@@ -1091,7 +1361,7 @@ namespace Ipopt
       }
       else
       {
-        jnlst_->FlushBuffer();
+        jnlst_->FinalFlush();
         throw;
       }
     }
@@ -1151,7 +1421,70 @@ namespace Ipopt
                                  obj, p2ip_data, p2ip_cq);
     }
 
-    jnlst_->FlushBuffer();
+    jnlst_->FinalFlush();
+
+    return retValue;
+  }
+
+  ApplicationReturnStatus
+  IpoptApplication::call_optimize_decomposed(TNLPDecomposition& decomp)
+  {
+    const Index ncomp = decomp.NumComponents();
+    jnlst_->Printf(J_SUMMARY, J_MAIN,
+                   "\nThe problem decomposes into %d independent blocks.\n",
+                   ncomp);
+
+    // The objects of the individual runs are not kept
+    nlp_adapter_ = NULL;
+    alg_ = NULL;
+    ip_nlp_ = NULL;
+    ip_data_ = NULL;
+    ip_cq_ = NULL;
+    statistics_ = NULL;
+
+    ApplicationReturnStatus retValue = Solve_Succeeded;
+    for (Index k=0; k<ncomp; k++) {
+      jnlst_->Printf(J_SUMMARY, J_MAIN,
+                     "\nSolving block %d of %d (%d variables, %d constraints).\n",
+                     k+1, ncomp, decomp.NumComponentVariables(k),
+                     decomp.NumComponentConstraints(k));
+
+      SmartPtr<IpoptApplication> app = clone();
+      app->Options()->SetStringValue("decompose_independent_blocks", "no");
+      // The solution of each block is collected through finalize_solution
+      app->Options()->SetStringValue("skip_finalize_solution_call", "no");
+
+      ApplicationReturnStatus status = app->OptimizeTNLP(decomp.Component(k));
+      if (retValue == Solve_Succeeded && status != Solve_Succeeded) {
+        retValue = status;
+      }
+
+      SmartPtr<SolveStatistics> stats = app->Statistics();
+      if (IsValid(stats)) {
+        if (IsNull(statistics_)) {
+          statistics_ = stats;
+        }
+        else {
+          statistics_->Accumulate(*stats);
+        }
+      }
+    }
+
+    bool skip_finalize_solution_call;
+    options_->GetBoolValue("skip_finalize_solution_call",
+                           skip_finalize_solution_call, "");
+    if (!skip_finalize_solution_call) {
+      Number obj_value;
+      decomp.FinalizeSolution(obj_value);
+      if (IsValid(statistics_)) {
+        Number obj_scaling_factor;
+        options_->GetNumericValue("obj_scaling_factor", obj_scaling_factor, "");
+        statistics_->SetFinalObjective(obj_value,
+                                       obj_scaling_factor*obj_value);
+      }
+    }
+
+    jnlst_->FinalFlush();
 
     return retValue;
   }
@@ -1162,9 +1495,26 @@ namespace Ipopt
     SmartPtr<Journal> file_jrnl = jnlst_->GetJournal("OutputFile:"+file_name);
 
     if (IsNull(file_jrnl)) {
-      file_jrnl = jnlst_->AddFileJournal("OutputFile:"+file_name,
-                                         file_name.c_str(),
-                                         print_level);
+      Index buffer_size;
+      options_->GetIntegerValue("output_file_buffer_size", buffer_size, "");
+      if (buffer_size > 0) {
+        Number flush_interval;
+        options_->GetNumericValue("output_file_flush_interval",
+                                  flush_interval, "");
+        bool drop_when_full;
+        options_->GetBoolValue("output_file_drop_when_full",
+                               drop_when_full, "");
+        file_jrnl = jnlst_->AddBufferedFileJournal("OutputFile:"+file_name,
+                                                   file_name.c_str(),
+                                                   print_level, buffer_size,
+                                                   flush_interval,
+                                                   drop_when_full);
+      }
+      else {
+        file_jrnl = jnlst_->AddFileJournal("OutputFile:"+file_name,
+                                           file_name.c_str(),
+                                           print_level);
+      }
     }
 
     // Check, if the output file could be created properly
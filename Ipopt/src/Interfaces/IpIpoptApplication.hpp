@@ -22,12 +22,14 @@
 #endif
 
 #include <iostream>
+#include <vector>
 
 #include "IpJournalist.hpp"
 #include "IpTNLP.hpp"
 #include "IpNLP.hpp"
 /* Return codes for the Optimize call for an application */
 #include "IpReturnCodes.hpp"
+#include "IpWarmStartCache.hpp"
 
 namespace Ipopt
 {
@@ -42,6 +44,7 @@ namespace Ipopt
   class RegisteredOptions;
   class OptionsList;
   class SolveStatistics;
+  class TNLPDecomposition;
 
   /** This is the main application class for making calls to Ipopt. */
   class IpoptApplication : public ReferencedObject
@@ -124,9 +127,17 @@ namespace Ipopt
 
     /** Solve a problem (that inherits from TNLP) for a repeated time.
      *  The OptimizeTNLP method must have been called before.  The
-     *  TNLP must be the same object, and the structure (number of
-     *  variables and constraints and position of nonzeros in Jacobian
-     *  and Hessian must be the same). */
+     *  structure (number of variables and constraints and position of
+     *  nonzeros in Jacobian and Hessian) must be the same.  The TNLP
+     *  can be a different object than in the previous call; the
+     *  algorithm objects that have been built for the previous
+     *  problem are then reused for the new one.  Together with the
+     *  option warm_start_same_structure, this also keeps the vector
+     *  spaces, the structure of the KKT system and the symbolic data
+     *  of the linear solver; in that case, the structure of the new
+     *  TNLP is compared with the previous one (see
+     *  TNLPAdapter::HasSameStructure), and INVALID_WARMSTART is thrown
+     *  if it differs. */
     virtual ApplicationReturnStatus ReOptimizeTNLP(const SmartPtr<TNLP>& tnlp);
 
     /** Solve a problem (that inherits from NLP) for a repeated time.
@@ -135,6 +146,45 @@ namespace Ipopt
      *  variables and constraints and position of nonzeros in Jacobian
      *  and Hessian must be the same). */
     virtual ApplicationReturnStatus ReOptimizeNLP(const SmartPtr<NLP>& nlp);
+
+    /** Solve a batch of independent problems (that inherit from TNLP)
+     *  one after another.  All problems are solved with the options,
+     *  registered options and journalist of this application, which
+     *  are set up only once.  If a problem has the same structure
+     *  as the one solved before it (see
+     *  TNLPAdapter::HasSameStructure), it is solved with
+     *  ReOptimizeTNLP and warm_start_same_structure, so that the
+     *  vector spaces, the structure of the KKT system and the
+     *  symbolic factorization are reused; batches should therefore
+     *  be ordered so that problems with the same structure are
+     *  adjacent.  On return, status[i] contains the
+     *  return status and statistics[i] the statistics (NULL if no
+     *  statistics are available) of the run for tnlps[i].  The
+     *  return value is Solve_Succeeded if all problems have been
+     *  solved successfully, and otherwise the first other return
+     *  status. */
+    virtual ApplicationReturnStatus OptimizeTNLPBatch(
+      const std::vector<SmartPtr<TNLP> >& tnlps,
+      std::vector<ApplicationReturnStatus>& status,
+      std::vector<SmartPtr<SolveStatistics> >& statistics);
+
+    /** Solve a problem (that inherits from TNLP) that depends on the
+     *  given vector of parameters.  The primal-dual solutions of
+     *  successful runs are stored, keyed by the parameters, in the
+     *  warm start cache of this application (see WarmStartSolutions).
+     *  If the cache contains a solution for a problem of the same
+     *  size, the solution with the nearest parameters is used as
+     *  starting point, and the options warm_start_init_point and
+     *  mu_init are set for this run to "yes" and the value of the
+     *  barrier parameter stored with the solution.  This is the final
+     *  barrier parameter of that run times warm_start_cache_mu_factor,
+     *  but at least mu_min, since the final value is too close to zero
+     *  for a problem with different parameters.  The remaining
+     *  warm start options (e.g., warm_start_bound_push) are taken
+     *  from the options of this application. */
+    virtual ApplicationReturnStatus OptimizeParametricTNLP(
+      const SmartPtr<TNLP>& tnlp,
+      const std::vector<Number>& parameters);
     //@}
 
     /** Method for opening an output file with given print_level.
@@ -172,6 +222,15 @@ namespace Ipopt
      *  optimization run. */
     virtual SmartPtr<SolveStatistics> Statistics();
 
+    /** Get the cache of solutions used by OptimizeParametricTNLP.
+     *  The cache is created, with the size given by the option
+     *  warm_start_cache_size, by the first call of
+     *  OptimizeParametricTNLP; before that, NULL is returned. */
+    virtual SmartPtr<WarmStartCache> WarmStartSolutions()
+    {
+      return warm_start_cache_;
+    }
+
     /** Get the IpoptNLP Object */
     virtual SmartPtr<IpoptNLP> IpoptNLPObject();
 
@@ -239,6 +298,11 @@ namespace Ipopt
      *  This is used both for Optimize and ReOptimize */
     ApplicationReturnStatus call_optimize();
 
+    /** Method for solving the independent blocks of a decomposed
+     *  TNLP one after another and passing the combined solution to
+     *  the original TNLP. */
+    ApplicationReturnStatus call_optimize_decomposed(TNLPDecomposition& decomp);
+
     /**@name Variables that customize the application behavior */
     //@{
     /** Decide whether or not the ipopt.opt file should be read */
@@ -283,6 +347,9 @@ namespace Ipopt
      *  We keep this around for the ReOptimizerTNLP call. */
     SmartPtr<NLP> nlp_adapter_;
 
+    /** Cache of solutions for OptimizeParametricTNLP */
+    SmartPtr<WarmStartCache> warm_start_cache_;
+
     /** @name Algorithmic parameters */
     //@{
     /** Flag indicating if we are to use the inexact linear solver option */
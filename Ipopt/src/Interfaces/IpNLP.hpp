@@ -132,6 +132,20 @@ namespace Ipopt
                         const Vector& yc,
                         const Vector& yd,
                         SymMatrix& h) = 0;
+
+    /** Method for computing the product h_v of the Hessian of the
+     *  Lagrangian with the vector v.  This is only called if the
+     *  option hessian_vector_products is chosen.  The default
+     *  implementation returns false. */
+    virtual bool Eval_h_prod(const Vector& x,
+                             Number obj_factor,
+                             const Vector& yc,
+                             const Vector& yd,
+                             const Vector& v,
+                             Vector& h_v)
+    {
+      return false;
+    }
     //@}
 
     /** @name NLP solution routines. Have default dummy
@@ -107,4 +107,35 @@ namespace Ipopt
     return scaled_obj_val_;
   }
 
+  void SolveStatistics::Accumulate(const SolveStatistics& other)
+  {
+    num_iters_ = Max(num_iters_, other.num_iters_);
+    total_cpu_time_ += other.total_cpu_time_;
+    total_sys_time_ += other.total_sys_time_;
+    total_wallclock_time_ += other.total_wallclock_time_;
+    num_obj_evals_ += other.num_obj_evals_;
+    num_constr_evals_ += other.num_constr_evals_;
+    num_obj_grad_evals_ += other.num_obj_grad_evals_;
+    num_constr_jac_evals_ += other.num_constr_jac_evals_;
+    num_hess_evals_ += other.num_hess_evals_;
+
+    scaled_obj_val_ += other.scaled_obj_val_;
+    obj_val_ += other.obj_val_;
+    scaled_dual_inf_ = Max(scaled_dual_inf_, other.scaled_dual_inf_);
+    dual_inf_ = Max(dual_inf_, other.dual_inf_);
+    scaled_constr_viol_ = Max(scaled_constr_viol_, other.scaled_constr_viol_);
+    constr_viol_ = Max(constr_viol_, other.constr_viol_);
+    scaled_compl_ = Max(scaled_compl_, other.scaled_compl_);
+    compl_ = Max(compl_, other.compl_);
+    scaled_kkt_error_ = Max(scaled_kkt_error_, other.scaled_kkt_error_);
+    kkt_error_ = Max(kkt_error_, other.kkt_error_);
+  }
+
+  void SolveStatistics::SetFinalObjective(Number obj_val,
+                                          Number scaled_obj_val)
+  {
+    obj_val_ = obj_val;
+    scaled_obj_val_ = scaled_obj_val;
+  }
+
 } // namespace Ipopt
@@ -81,6 +81,17 @@ namespace Ipopt
     virtual Number FinalScaledObjective() const;
     //@}
 
+    /** @name Methods for combining the statistics of independent
+     *  subproblems that have been solved separately */
+    //@{
+    /** Add the statistics of another run.  Times, evaluation counts
+     *  and objective values are summed up, and the iteration count
+     *  and the infeasibilities are the maximum of both runs. */
+    virtual void Accumulate(const SolveStatistics& other);
+    /** Overwrite the final values of the objective function */
+    virtual void SetFinalObjective(Number obj_val, Number scaled_obj_val);
+    //@}
+
   private:
     /**@name Default Compiler Generated Methods
      * (Hidden to avoid implicit creation/calling).
@@ -11,6 +11,8 @@
 #include "IpOptionsList.hpp"
 #include "IpIpoptApplication.hpp"
 
+#include <vector>
+
 struct IpoptProblemInfo
 {
   Index n;
@@ -32,6 +34,12 @@ struct IpoptProblemInfo
   Number obj_scaling;
   Number* x_scaling;
   Number* g_scaling;
+  /** Flag indicating whether the problem has been solved before, so
+   *  that IpoptReSolve can reuse the application state */
+  bool solved;
+  /** Structure of the problem at the previous solve (see
+   *  structure_signature); only meaningful if solved is true */
+  std::vector< ::Index> structure;
 };
 
 IpoptProblem CreateIpoptProblem(
@@ -101,6 +109,8 @@ IpoptProblem CreateIpoptProblem(
   retval->x_scaling = NULL;
   retval->g_scaling = NULL;
 
+  retval->solved = false;
+
   retval->app->RethrowNonIpoptException(false);
 
   return retval;
@@ -196,8 +206,126 @@ Bool SetIntermediateCallback(IpoptProblem ipopt_problem,
 }
 
 
-enum ApplicationReturnStatus IpoptSolve(
+Bool SetIpoptProblemBounds(IpoptProblem ipopt_problem,
+                           Number* x_L,
+                           Number* x_U,
+                           Number* g_L,
+                           Number* g_U)
+{
+  if (x_L) {
+    for (::Index i=0; i<ipopt_problem->n; i++) {
+      ipopt_problem->x_L[i] = x_L[i];
+    }
+  }
+  if (x_U) {
+    for (::Index i=0; i<ipopt_problem->n; i++) {
+      ipopt_problem->x_U[i] = x_U[i];
+    }
+  }
+  if (g_L) {
+    for (::Index i=0; i<ipopt_problem->m; i++) {
+      ipopt_problem->g_L[i] = g_L[i];
+    }
+  }
+  if (g_U) {
+    for (::Index i=0; i<ipopt_problem->m; i++) {
+      ipopt_problem->g_U[i] = g_U[i];
+    }
+  }
+
+  return (Bool)true;
+}
+
+/** Compute the data that determines the structure of the problem as
+ *  seen by the algorithm objects: the problem dimensions, one code
+ *  per variable and constraint for the kind of bounds (4 for fixed,
+ *  otherwise 1 for a finite lower bound plus 2 for a finite upper
+ *  bound), and the positions of the nonzeros in the Jacobian and (if
+ *  exact second derivatives are used) in the Hessian.  Returns false
+ *  if one of the callbacks fails. */
+static bool structure_signature(
+  IpoptProblem ipopt_problem,
+  UserDataPtr user_data,
+  std::vector< ::Index>& signature)
+{
+  using namespace Ipopt;
+
+  SmartPtr<OptionsList> options = ipopt_problem->app->Options();
+  Ipopt::Number lower_inf, upper_inf;
+  options->GetNumericValue("nlp_lower_bound_inf", lower_inf, "");
+  options->GetNumericValue("nlp_upper_bound_inf", upper_inf, "");
+  std::string hessian_approximation;
+  options->GetStringValue("hessian_approximation", hessian_approximation,
+                          "");
+
+  const ::Index n = ipopt_problem->n;
+  const ::Index m = ipopt_problem->m;
+  const ::Index nele_jac = ipopt_problem->nele_jac;
+  const ::Index nele_hess = ipopt_problem->nele_hess;
+
+  signature.clear();
+  signature.reserve(4 + n + m + 2*nele_jac + 2*nele_hess);
+  signature.push_back(n);
+  signature.push_back(m);
+  signature.push_back(nele_jac);
+  signature.push_back(nele_hess);
+  for (::Index i=0; i<n; i++) {
+    const ::Number x_L = ipopt_problem->x_L[i];
+    const ::Number x_U = ipopt_problem->x_U[i];
+    if (x_L == x_U) {
+      signature.push_back(4);
+    }
+    else {
+      signature.push_back((x_L > lower_inf ? 1 : 0) +
+                          (x_U < upper_inf ? 2 : 0));
+    }
+  }
+  for (::Index i=0; i<m; i++) {
+    const ::Number g_L = ipopt_problem->g_L[i];
+    const ::Number g_U = ipopt_problem->g_U[i];
+    if (g_L == g_U) {
+      signature.push_back(4);
+    }
+    else {
+      signature.push_back((g_L > lower_inf ? 1 : 0) +
+                          (g_U < upper_inf ? 2 : 0));
+    }
+  }
+
+  std::vector< ::Index> iRow(nele_jac);
+  std::vector< ::Index> jCol(nele_jac);
+  if (nele_jac > 0) {
+    if (!(*ipopt_problem->eval_jac_g)(n, NULL, (Bool)false, m, nele_jac,
+                                      &iRow[0], &jCol[0], NULL,
+                                      user_data)) {
+      return false;
+    }
+    signature.insert(signature.end(), iRow.begin(), iRow.end());
+    signature.insert(signature.end(), jCol.begin(), jCol.end());
+  }
+
+  if (hessian_approximation == "exact" && ipopt_problem->eval_h &&
+      nele_hess > 0) {
+    iRow.resize(nele_hess);
+    jCol.resize(nele_hess);
+    if (!(*ipopt_problem->eval_h)(n, NULL, (Bool)false, 0., m, NULL,
+                                  (Bool)false, nele_hess, &iRow[0],
+                                  &jCol[0], NULL, user_data)) {
+      return false;
+    }
+    signature.insert(signature.end(), iRow.begin(), iRow.end());
+    signature.insert(signature.end(), jCol.begin(), jCol.end());
+  }
+
+  return true;
+}
+
+/** Common implementation of IpoptSolve and IpoptReSolve.  If resolve
+ *  is true, the problem is solved with ReOptimizeTNLP, reusing the
+ *  algorithm objects of the previous solve. */
+static enum ApplicationReturnStatus solve(
   IpoptProblem ipopt_problem,
+  bool resolve,
   Number* x,
   Number* g,
   Number* obj_val,
@@ -208,10 +336,12 @@ enum ApplicationReturnStatus IpoptSolve(
 {
   using namespace Ipopt;
 
-  // Initialize and process options
-  Ipopt::ApplicationReturnStatus retval = ipopt_problem->app->Initialize();
-  if (retval!=Ipopt::Solve_Succeeded) {
-    return (::ApplicationReturnStatus) retval;
+  if (!resolve) {
+    // Initialize and process options
+    Ipopt::ApplicationReturnStatus retval = ipopt_problem->app->Initialize();
+    if (retval!=Ipopt::Solve_Succeeded) {
+      return (::ApplicationReturnStatus) retval;
+    }
   }
 
   if (!x) {
@@ -269,15 +399,57 @@ enum ApplicationReturnStatus IpoptSolve(
                                 ipopt_problem->obj_scaling,
                                 ipopt_problem->x_scaling,
                                 ipopt_problem->g_scaling);
-    status = ipopt_problem->app->OptimizeTNLP(tnlp);
+    // The algorithm objects of the previous solve can only be reused
+    // if the structure of the problem has not changed, e.g., by
+    // fixing a variable with SetIpoptProblemBounds
+    std::vector< ::Index> structure;
+    if (!structure_signature(ipopt_problem, user_data, structure)) {
+      structure.clear();
+    }
+    if (resolve && (structure.empty() ||
+                    structure != ipopt_problem->structure)) {
+      ipopt_problem->app->Jnlst()->Printf(J_DETAILED, J_MAIN,
+                                          "The structure of the problem has changed since the previous solve, solving it from scratch.\n");
+      resolve = false;
+    }
+
+    if (resolve) {
+      // Keep the vector spaces, the KKT structure and the symbolic
+      // factorization of the previous solve; the option is reset
+      // afterwards so that a later IpoptSolve starts from scratch
+      SmartPtr<OptionsList> options = ipopt_problem->app->Options();
+      std::string same_structure;
+      options->GetStringValue("warm_start_same_structure",
+                              same_structure, "");
+      options->SetStringValue("warm_start_same_structure", "yes");
+      try {
+        status = ipopt_problem->app->ReOptimizeTNLP(tnlp);
+      }
+      catch (...) {
+        options->SetStringValue("warm_start_same_structure", same_structure);
+        throw;
+      }
+      options->SetStringValue("warm_start_same_structure", same_structure);
+    }
+    else {
+      status = ipopt_problem->app->OptimizeTNLP(tnlp);
+    }
+    // Only reuse the application state if the problem setup succeeded
+    ipopt_problem->solved = (status > Ipopt::Not_Enough_Degrees_Of_Freedom ||
+                             status == Ipopt::Invalid_Number_Detected);
+    if (ipopt_problem->solved) {
+      ipopt_problem->structure.swap(structure);
+    }
   }
   catch (INVALID_STDINTERFACE_NLP& exc) {
     exc.ReportException(*ipopt_problem->app->Jnlst(), J_ERROR);
     status = Ipopt::Invalid_Problem_Definition;
+    ipopt_problem->solved = false;
   }
   catch( IpoptException& exc ) {
     exc.ReportException(*ipopt_problem->app->Jnlst(), J_ERROR);
     status = Ipopt::Unrecoverable_Exception;
+    ipopt_problem->solved = false;
   }
 
   delete [] start_x;
@@ -288,3 +460,30 @@ enum ApplicationReturnStatus IpoptSolve(
   return (::ApplicationReturnStatus) status;
 }
 
+enum ApplicationReturnStatus IpoptSolve(
+  IpoptProblem ipopt_problem,
+  Number* x,
+  Number* g,
+  Number* obj_val,
+  Number* mult_g,
+  Number* mult_x_L,
+  Number* mult_x_U,
+  UserDataPtr user_data)
+{
+  return solve(ipopt_problem, false, x, g, obj_val, mult_g, mult_x_L,
+               mult_x_U, user_data);
+}
+
+enum ApplicationReturnStatus IpoptReSolve(
+  IpoptProblem ipopt_problem,
+  Number* x,
+  Number* g,
+  Number* obj_val,
+  Number* mult_g,
+  Number* mult_x_L,
+  Number* mult_x_U,
+  UserDataPtr user_data)
+{
+  return solve(ipopt_problem, ipopt_problem->solved, x, g, obj_val, mult_g,
+               mult_x_L, mult_x_U, user_data);
+}
@@ -260,6 +260,50 @@ extern "C"
                              functions. */
   );
 
+  /** Function for changing the bounds of a problem previously
+   *  defined with CreateIpoptProblem, e.g., before a call of
+   *  IpoptReSolve.  The new values are copied.  If one of the
+   *  pointers is NULL, the corresponding bounds remain unchanged.
+   *  If the set of fixed variables (with equal lower and upper
+   *  bounds) or of finite bounds changes, the next IpoptReSolve
+   *  cannot reuse the structure of the previous solve and solves
+   *  the problem from scratch. */
+  IPOPT_EXPORT(Bool) SetIpoptProblemBounds(IpoptProblem ipopt_problem,
+			     Number* x_L,
+			     Number* x_U,
+			     Number* g_L,
+			     Number* g_U);
+
+  /** Function calling the Ipopt optimization algorithm for a problem
+      that has been solved before with IpoptSolve (or IpoptReSolve).
+      The arguments are the same as for IpoptSolve; the starting
+      point and multipliers are taken from x, mult_g, mult_x_L and
+      mult_x_U, and the bounds from the last call of
+      SetIpoptProblemBounds.  Instead of setting up the algorithm
+      from scratch, the algorithm objects, vector spaces, the
+      structure of the KKT system and the symbolic factorization of
+      the linear solver of the previous solve are reused (as for the
+      option warm_start_same_structure).  The options are not
+      re-read from the options file; options set with
+      AddIpoptStrOption (etc) since the last solve take effect.  If
+      there was no previous solve, or if it failed before the
+      algorithm was set up, this is the same as IpoptSolve.  If the
+      structure of the problem (fixed variables, finite bounds, and
+      positions of the nonzeros in the Jacobian and Hessian) differs
+      from that of the previous solve, the problem is solved from
+      scratch, but without re-reading the options file.
+   */
+  IPOPT_EXPORT(enum ApplicationReturnStatus) IpoptReSolve(
+      IpoptProblem ipopt_problem
+    , Number* x
+    , Number* g
+    , Number* obj_val
+    , Number* mult_g
+    , Number* mult_x_L
+    , Number* mult_x_U
+    , UserDataPtr user_data
+  );
+
   /**
   void IpoptStatisticsCounts;
 
@@ -295,6 +295,45 @@ fint F77_FUNC(ipsolve,IPSOLVE)
                           MULT_G, MULT_X_L, MULT_X_U, user_data);
 }
 
+fint F77_FUNC(ipresolve,IPRESOLVE)
+(fptr* FProblem,
+ fdouble* X,
+ fdouble* G,
+ fdouble* OBJ_VAL,
+ fdouble* MULT_G,
+ fdouble* MULT_X_L,
+ fdouble* MULT_X_U,
+ fint* IDAT,
+ fdouble* DDAT)
+{
+  FUserData* fuser_data = (FUserData*) *FProblem;
+  UserDataPtr user_data;
+
+  fuser_data->IDAT = IDAT;
+  fuser_data->DDAT = DDAT;
+  user_data = (UserDataPtr) fuser_data;
+
+  return (fint)IpoptReSolve(fuser_data->Problem, X, G, OBJ_VAL,
+                            MULT_G, MULT_X_L, MULT_X_U, user_data);
+}
+
+fint F77_FUNC(ipsetbounds,IPSETBOUNDS)
+(fptr* FProblem,
+ fdouble* X_L,
+ fdouble* X_U,
+ fdouble* G_L,
+ fdouble* G_U)
+{
+  FUserData* fuser_data = (FUserData*) *FProblem;
+
+  if (SetIpoptProblemBounds(fuser_data->Problem, X_L, X_U, G_L, G_U)) {
+    return OKRetVal;
+  }
+  else {
+    return NotOKRetVal;
+  }
+}
+
 static char* f2cstr(char* FSTR, int slen)
 {
   int len;
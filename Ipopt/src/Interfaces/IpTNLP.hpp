@@ -200,11 +200,89 @@ namespace Ipopt
     {
       return false;
     }
+
+    /** overload this method to return the product of the hessian of
+     *  the lagrangian (with obj_factor and lambda as in eval_h) with
+     *  the vector v of length n in hv.  This method is only called if
+     *  the option "hessian_vector_products" is set to "yes"; the
+     *  values of the hessian are then never requested from eval_h,
+     *  so that nnz_h_lag in get_nlp_info can be zero.  The default
+     *  implementation returns false. */
+    virtual bool eval_h_prod(Index n, const Number* x, bool new_x,
+                             Number obj_factor, Index m,
+                             const Number* lambda, bool new_lambda,
+                             const Number* v, Number* hv)
+    {
+      return false;
+    }
+
+    /** Flags for the quantities requested in a call of eval_all */
+    enum EvalAllRequest
+    {
+      EVAL_F=1,
+      EVAL_G=2,
+      EVAL_GRAD_F=4,
+      EVAL_JAC_G=8,
+      EVAL_H=16
+    };
+
+    /** overload this method to compute several quantities at x in
+     *  one pass.  This method is only called if the option
+     *  "eval_all_callback" is set to "yes"; it is then used by the
+     *  optimization algorithm instead of eval_f, eval_grad_f, eval_g,
+     *  eval_jac_g, and eval_h.  request is a combination of the flags
+     *  in EvalAllRequest; only the requested quantities have to be
+     *  computed, and the arrays for the other quantities are NULL.
+     *  Ipopt requests the function values (objective and constraints)
+     *  together at each trial point of the line search, the
+     *  derivatives (gradient and Jacobian, and the function values if
+     *  they have not been requested yet) together at accepted points,
+     *  and the Hessian of the Lagrangian (with obj_factor and lambda
+     *  as in eval_h) on its own.  The values of the Jacobian and the
+     *  Hessian are in the order of the structure returned by
+     *  eval_jac_g and eval_h, which are still called for the
+     *  structure; the individual methods are also still used during
+     *  the problem setup and by the derivative checker.  The default
+     *  implementation calls the individual evaluation methods. */
+    virtual bool eval_all(Index n, const Number* x, bool new_x,
+                          Index request, Number& obj_value,
+                          Number* grad_f, Index m, Number* g,
+                          Index nele_jac, Number* jac_values,
+                          Number obj_factor, const Number* lambda,
+                          bool new_lambda, Index nele_hess,
+                          Number* hess_values)
+    {
+      bool retval = true;
+      if (request & EVAL_F) {
+        retval = eval_f(n, x, new_x, obj_value);
+        new_x = false;
+      }
+      if (retval && (request & EVAL_G)) {
+        retval = eval_g(n, x, new_x, m, g);
+        new_x = false;
+      }
+      if (retval && (request & EVAL_GRAD_F)) {
+        retval = eval_grad_f(n, x, new_x, grad_f);
+        new_x = false;
+      }
+      if (retval && (request & EVAL_JAC_G)) {
+        retval = eval_jac_g(n, x, new_x, m, nele_jac, NULL, NULL,
+                            jac_values);
+        new_x = false;
+      }
+      if (retval && (request & EVAL_H)) {
+        retval = eval_h(n, x, new_x, obj_factor, m, lambda, new_lambda,
+                        nele_hess, NULL, NULL, hess_values);
+      }
+      return retval;
+    }
     //@}
 
     /** @name Solution Methods */
     //@{
-    /** This method is called when the algorithm is complete so the TNLP can store/write the solution */
+    /** This method is called when the algorithm is complete so the TNLP can store/write the solution.
+     *  ip_data and ip_cq are NULL if the problem has been solved in
+     *  independent blocks (option decompose_independent_blocks). */
     virtual void finalize_solution(SolverReturn status,
                                    Index n, const Number* x, const Number* z_L, const Number* z_U,
                                    Index m, const Number* g, const Number* lambda,
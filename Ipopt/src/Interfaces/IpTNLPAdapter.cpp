@@ -66,16 +66,22 @@ namespace Ipopt
       :
       tnlp_(tnlp),
       jnlst_(jnlst),
+      keep_solution_(false),
       full_x_(NULL),
+      x_eval_(NULL),
       full_lambda_(NULL),
       full_g_(NULL),
       jac_g_(NULL),
+      full_grad_f_(NULL),
       c_rhs_(NULL),
       x_tag_for_iterates_(0),
       y_c_tag_for_iterates_(0),
       y_d_tag_for_iterates_(0),
       x_tag_for_g_(0),
       x_tag_for_jac_g_(0),
+      x_tag_for_f_(0),
+      x_tag_for_grad_f_(0),
+      direct_g_(false),
       jac_idx_map_(NULL),
       h_idx_map_(NULL),
       x_fixed_map_(NULL),
@@ -95,6 +101,7 @@ namespace Ipopt
     delete [] full_lambda_;
     delete [] full_g_;
     delete [] jac_g_;
+    delete [] full_grad_f_;
     delete [] c_rhs_;
     delete [] jac_idx_map_;
     delete [] h_idx_map_;
@@ -106,6 +113,138 @@ namespace Ipopt
     delete [] findiff_x_u_;
   }
 
+  void TNLPAdapter::SetTNLP(const SmartPtr<TNLP>& tnlp)
+  {
+    ASSERT_EXCEPTION(IsValid(tnlp), INVALID_TNLP,
+                     "The TNLP passed to TNLPAdapter is NULL. This MUST be a valid TNLP!");
+    if (full_x_) {
+      Index n_full_x, n_full_g, nz_full_jac_g, nz_full_h;
+      TNLP::IndexStyleEnum index_style;
+      bool retval = tnlp->get_nlp_info(n_full_x, n_full_g, nz_full_jac_g,
+                                       nz_full_h, index_style);
+      ASSERT_EXCEPTION(retval, INVALID_TNLP, "get_nlp_info returned false");
+      ASSERT_EXCEPTION(n_full_x == n_full_x_ &&
+                       n_full_g == n_full_g_ &&
+                       nz_full_jac_g == nz_full_jac_g_ &&
+                       nz_full_h == nz_full_h_ &&
+                       index_style == index_style_,
+                       INVALID_WARMSTART,
+                       "New TNLP has different problem dimensions.");
+    }
+    tnlp_ = tnlp;
+
+    // The new TNLP has not seen any point yet
+    x_tag_for_iterates_ = 0;
+    y_c_tag_for_iterates_ = 0;
+    y_d_tag_for_iterates_ = 0;
+    x_eval_vector_ = NULL;
+    x_tag_for_g_ = 0;
+    x_tag_for_jac_g_ = 0;
+    x_tag_for_f_ = 0;
+    x_tag_for_grad_f_ = 0;
+  }
+
+  bool TNLPAdapter::HasSameStructure(const SmartPtr<TNLP>& tnlp) const
+  {
+    if (structure_signature_.empty() || IsValid(dependency_detector_)) {
+      return false;
+    }
+    std::vector<Index> signature;
+    if (!ComputeStructureSignature(tnlp, signature)) {
+      return false;
+    }
+    return signature == structure_signature_;
+  }
+
+  bool TNLPAdapter::ComputeStructureSignature(const SmartPtr<TNLP>& tnlp,
+      std::vector<Index>& signature) const
+  {
+    DBG_START_METH("TNLPAdapter::ComputeStructureSignature", dbg_verbosity);
+
+    Index n_full_x, n_full_g, nz_full_jac_g, nz_full_h;
+    TNLP::IndexStyleEnum index_style;
+    if (!tnlp->get_nlp_info(n_full_x, n_full_g, nz_full_jac_g,
+                            nz_full_h, index_style)) {
+      return false;
+    }
+
+    // Layout: dimensions, one code per variable and constraint for
+    // the kind of bounds (4 for fixed, otherwise 1 for a finite lower
+    // bound plus 2 for a finite upper bound), and the positions of
+    // the nonzeros in the Jacobian and the Hessian
+    signature.clear();
+    signature.reserve(5 + n_full_x + n_full_g + 2*nz_full_jac_g
+                      + 2*nz_full_h);
+    signature.push_back(n_full_x);
+    signature.push_back(n_full_g);
+    signature.push_back(nz_full_jac_g);
+    signature.push_back(nz_full_h);
+    signature.push_back((Index)index_style);
+
+    Number* x_l = new Number[n_full_x];
+    Number* x_u = new Number[n_full_x];
+    Number* g_l = new Number[n_full_g];
+    Number* g_u = new Number[n_full_g];
+    bool retval = tnlp->get_bounds_info(n_full_x, x_l, x_u,
+                                        n_full_g, g_l, g_u);
+    if (retval) {
+      for (Index i=0; i<n_full_x; i++) {
+        if (x_l[i] == x_u[i]) {
+          signature.push_back(4);
+        }
+        else {
+          signature.push_back((x_l[i] > nlp_lower_bound_inf_ ? 1 : 0) +
+                              (x_u[i] < nlp_upper_bound_inf_ ? 2 : 0));
+        }
+      }
+      for (Index i=0; i<n_full_g; i++) {
+        if (g_l[i] == g_u[i]) {
+          signature.push_back(4);
+        }
+        else {
+          signature.push_back((g_l[i] > nlp_lower_bound_inf_ ? 1 : 0) +
+                              (g_u[i] < nlp_upper_bound_inf_ ? 2 : 0));
+        }
+      }
+    }
+    delete [] x_l;
+    delete [] x_u;
+    delete [] g_l;
+    delete [] g_u;
+    if (!retval) {
+      return false;
+    }
+
+    Index* iRow = new Index[nz_full_jac_g];
+    Index* jCol = new Index[nz_full_jac_g];
+    retval = tnlp->eval_jac_g(n_full_x, NULL, false, n_full_g,
+                              nz_full_jac_g, iRow, jCol, NULL);
+    if (retval) {
+      signature.insert(signature.end(), iRow, iRow + nz_full_jac_g);
+      signature.insert(signature.end(), jCol, jCol + nz_full_jac_g);
+    }
+    delete [] iRow;
+    delete [] jCol;
+    if (!retval) {
+      return false;
+    }
+
+    if (hessian_approximation_ == EXACT && !hessian_vector_products_) {
+      iRow = new Index[nz_full_h];
+      jCol = new Index[nz_full_h];
+      retval = tnlp->eval_h(n_full_x, NULL, false, 0, n_full_g, NULL,
+                            false, nz_full_h, iRow, jCol, NULL);
+      if (retval) {
+        signature.insert(signature.end(), iRow, iRow + nz_full_h);
+        signature.insert(signature.end(), jCol, jCol + nz_full_h);
+      }
+      delete [] iRow;
+      delete [] jCol;
+    }
+
+    return retval;
+  }
+
   void TNLPAdapter::RegisterOptions(SmartPtr<RegisteredOptions> roptions)
   {
     roptions->SetRegisteringCategory("NLP");
@@ -208,6 +347,18 @@ namespace Ipopt
       "exact", "user-provided derivatives",
       "finite-difference-values", "user-provided structure, values by finite differences"
     );
+    roptions->AddStringOption2(
+      "eval_all_callback",
+      "Indicates whether the problem functions are computed with the combined evaluation method.",
+      "no",
+      "no", "use the individual evaluation methods of the TNLP",
+      "yes", "use TNLP::eval_all",
+      "If selected, the objective and constraint functions and their "
+      "derivatives are computed with the eval_all method of the TNLP, which "
+      "receives a mask of all quantities that are needed at a point.  The "
+      "function values are requested together at each trial point, and the "
+      "first derivatives together at accepted points, so that the model can "
+      "compute them in one pass.");
     roptions->AddLowerBoundedNumberOption(
       "findiff_perturbation",
       "Size of the finite difference perturbation for derivative approximation.",
@@ -223,6 +374,36 @@ namespace Ipopt
       "indicates the maximal perturbation.  This is for example used when "
       "determining the center point at which the finite difference derivative "
       "test is executed.");
+    roptions->SetRegisteringCategory("Warm Start");
+    roptions->AddStringOption2(
+      "warm_start_previous_solution",
+      "Take the starting point from the solution of the previous run.",
+      "no",
+      "no", "ask the TNLP for the starting point",
+      "yes", "use the final iterate of the previous optimization run",
+      "If the problem is solved repeatedly (see "
+      "IpoptApplication::ReOptimizeTNLP), the starting point (and the "
+      "multipliers, if \"warm_start_init_point\" is chosen) is taken from "
+      "the final iterate of the previous run instead of calling "
+      "TNLP::get_starting_point.  Together with \"warm_start_shift_x\", "
+      "\"warm_start_shift_g\", \"max_iter\" and \"max_wall_time\", this "
+      "gives a real-time iteration scheme for model-predictive control.");
+    roptions->AddLowerBoundedIntegerOption(
+      "warm_start_shift_x",
+      "Shift of the previous solution for the variables.",
+      0, 0,
+      "If \"warm_start_previous_solution\" is chosen, entry i of the "
+      "starting point for the variables and their bound multipliers is "
+      "taken from entry i+k of the previous solution, where k is the value "
+      "of this option.  The last k entries keep their previous values.  If "
+      "the variables are ordered by time stages, k is the number of "
+      "variables per stage.");
+    roptions->AddLowerBoundedIntegerOption(
+      "warm_start_shift_g",
+      "Shift of the previous solution for the constraint multipliers.",
+      0, 0,
+      "Same as \"warm_start_shift_x\", but for the multipliers of the "
+      "constraints.");
   }
 
   bool TNLPAdapter::ProcessOptions(const OptionsList& options,
@@ -259,17 +440,28 @@ namespace Ipopt
     // The following is registered in OrigIpoptNLP
     options.GetEnumValue("hessian_approximation", enum_int, prefix);
     hessian_approximation_ = HessianApproximationType(enum_int);
+    options.GetBoolValue("hessian_vector_products",
+                         hessian_vector_products_, prefix);
+    if (hessian_approximation_ != EXACT) {
+      hessian_vector_products_ = false;
+    }
     options.GetIntegerValue("num_linear_variables", num_linear_variables_,
                             prefix);
 
     options.GetEnumValue("jacobian_approximation", enum_int, prefix);
     jacobian_approximation_ = JacobianApproxEnum(enum_int);
+    options.GetBoolValue("eval_all_callback", eval_all_, prefix);
     options.GetNumericValue("findiff_perturbation",
                             findiff_perturbation_, prefix);
 
     options.GetNumericValue("point_perturbation_radius",
                             point_perturbation_radius_, prefix);
 
+    options.GetBoolValue("warm_start_previous_solution",
+                         warm_start_previous_solution_, prefix);
+    options.GetIntegerValue("warm_start_shift_x", warm_start_shift_x_, prefix);
+    options.GetIntegerValue("warm_start_shift_g", warm_start_shift_g_, prefix);
+
     options.GetNumericValue("tol", tol_, prefix);
 
     options.GetBoolValue("dependency_detection_with_rhs",
@@ -384,6 +576,8 @@ namespace Ipopt
       full_g_ = NULL;
       delete [] jac_g_;
       jac_g_ = NULL;
+      delete [] full_grad_f_;
+      full_grad_f_ = NULL;
       delete [] c_rhs_;
       c_rhs_ = NULL;
       delete [] jac_idx_map_;
@@ -412,6 +606,12 @@ namespace Ipopt
     nz_full_h_ = nz_full_h;
 
     if (!warm_start_same_structure_) {
+      // remember the structure so that later TNLPs can be checked
+      // against it in HasSameStructure
+      if (!ComputeStructureSignature(tnlp_, structure_signature_)) {
+        structure_signature_.clear();
+      }
+
       // create space to store vectors that are the full length of x
       full_x_ = new Number[n_full_x_];
 
@@ -440,6 +640,9 @@ namespace Ipopt
       // allocate internal space to store the full jacobian
       jac_g_ = new Number[nz_full_jac_g_];
 
+      // space for the full gradient of f, if computed by eval_all
+      full_grad_f_ = new Number[n_full_x_];
+
       /* Spaces for bounds. We need to remove the fixed variables
        * and find out which bounds do not exist. */
       Number* x_l = new Number[n_full_x_];
@@ -1198,7 +1401,7 @@ namespace Ipopt
       delete [] g_jCol;
       g_jCol = NULL;
 
-      if (hessian_approximation_==EXACT) {
+      if (hessian_approximation_==EXACT && !hessian_vector_products_) {
         /** Create the matrix space for the hessian of the lagrangian */
         Index* full_h_iRow = new Index[nz_full_h_];
         Index* full_h_jCol = new Index[nz_full_h_];
@@ -1265,8 +1468,23 @@ namespace Ipopt
         nz_h_ = 0;
         Hess_lagrangian_space_ = NULL;
       }
+
     } /* if (warm_start_same_structure_) { */
 
+    // If no variables or constraints have been removed and all
+    // constraints are of the same type, the values of g and its
+    // Jacobian are written directly into c or d and their Jacobian,
+    // without the intermediate copies in full_g_ and jac_g_.
+    direct_g_ = (IsNull(P_x_full_x_) && n_x_fixed_ == 0 &&
+                 jacobian_approximation_ == JAC_EXACT && !eval_all_ &&
+                 (c_space_->Dim() == n_full_g_ ||
+                  d_space_->Dim() == n_full_g_));
+    for (Index i=0; direct_g_ && i<nz_full_jac_g_; i++) {
+      if (jac_idx_map_[i] != i) {
+        direct_g_ = false;
+      }
+    }
+
     // Assign the spaces to the returned pointers
     x_space = x_space_;
     c_space = c_space_;
@@ -1445,6 +1663,42 @@ namespace Ipopt
     return true;
   }
 
+  void TNLPAdapter::ShiftValues(Index n, Index shift,
+                                const std::vector<Number>& prev,
+                                Number* values)
+  {
+    for (Index i=0; i<n; i++) {
+      values[i] = (i + shift < n) ? prev[i + shift] : prev[i];
+    }
+  }
+
+  void TNLPAdapter::SetStartingPoint(const std::vector<Number>& x,
+                                     const std::vector<Number>& z_L,
+                                     const std::vector<Number>& z_U,
+                                     const std::vector<Number>& lambda)
+  {
+    DBG_ASSERT(z_L.size() == x.size() && z_U.size() == x.size());
+    start_x_ = x;
+    start_z_L_ = z_L;
+    start_z_U_ = z_U;
+    start_lambda_ = lambda;
+  }
+
+  bool TNLPAdapter::GetSolution(std::vector<Number>& x,
+                                std::vector<Number>& z_L,
+                                std::vector<Number>& z_U,
+                                std::vector<Number>& lambda) const
+  {
+    if (prev_x_.empty()) {
+      return false;
+    }
+    x = prev_x_;
+    z_L = prev_z_L_;
+    z_U = prev_z_U_;
+    lambda = prev_lambda_;
+    return true;
+  }
+
   bool TNLPAdapter::GetStartingPoint(SmartPtr<Vector> x,
                                      bool need_x,
                                      SmartPtr<Vector> y_c,
@@ -1465,10 +1719,32 @@ namespace Ipopt
     bool init_z = need_z_L || need_z_U;
     bool init_lambda = need_y_c || need_y_d;
 
-    bool retvalue =
-      tnlp_->get_starting_point(n_full_x_, init_x, full_x, init_z,
-                                full_z_l, full_z_u, n_full_g_, init_lambda,
-                                full_lambda);
+    bool retvalue;
+    if ((Index)start_x_.size() == n_full_x_ &&
+        (Index)start_lambda_.size() == n_full_g_) {
+      // Start from the point given by SetStartingPoint
+      ShiftValues(n_full_x_, 0, start_x_, full_x);
+      ShiftValues(n_full_x_, 0, start_z_L_, full_z_l);
+      ShiftValues(n_full_x_, 0, start_z_U_, full_z_u);
+      ShiftValues(n_full_g_, 0, start_lambda_, full_lambda);
+      retvalue = true;
+    }
+    else if (warm_start_previous_solution_ &&
+        (Index)prev_x_.size() == n_full_x_ &&
+        (Index)prev_lambda_.size() == n_full_g_) {
+      // Start from the shifted previous solution
+      ShiftValues(n_full_x_, warm_start_shift_x_, prev_x_, full_x);
+      ShiftValues(n_full_x_, warm_start_shift_x_, prev_z_L_, full_z_l);
+      ShiftValues(n_full_x_, warm_start_shift_x_, prev_z_U_, full_z_u);
+      ShiftValues(n_full_g_, warm_start_shift_g_, prev_lambda_, full_lambda);
+      retvalue = true;
+    }
+    else {
+      retvalue =
+        tnlp_->get_starting_point(n_full_x_, init_x, full_x, init_z,
+                                  full_z_l, full_z_u, n_full_g_, init_lambda,
+                                  full_lambda);
+    }
 
     if (!retvalue) {
       delete [] full_x;
@@ -1585,7 +1861,15 @@ namespace Ipopt
     if (update_local_x(x)) {
       new_x = true;
     }
-    return tnlp_->eval_f(n_full_x_, full_x_, new_x, f);
+    if (eval_all_) {
+      // The constraints are needed at the same point
+      if (internal_eval_all(TNLP::EVAL_F | TNLP::EVAL_G, new_x)) {
+        f = full_f_;
+        return true;
+      }
+      return false;
+    }
+    return tnlp_->eval_f(n_full_x_, x_eval_, new_x, f);
   }
 
   bool TNLPAdapter::Eval_grad_f(const Vector& x, Vector& g_f)
@@ -1599,9 +1883,29 @@ namespace Ipopt
     DenseVector* dg_f = static_cast<DenseVector*>(&g_f);
     DBG_ASSERT(dynamic_cast<DenseVector*>(&g_f));
     Number* values = dg_f->Values();
-    if (IsValid(P_x_full_x_)) {
+    if (eval_all_) {
+      // The point has been accepted, so that the Jacobian is needed
+      // as well
+      Index request = TNLP::EVAL_F | TNLP::EVAL_G | TNLP::EVAL_GRAD_F;
+      if (jacobian_approximation_ == JAC_EXACT) {
+        request |= TNLP::EVAL_JAC_G;
+      }
+      if (internal_eval_all(request, new_x)) {
+        if (IsValid(P_x_full_x_)) {
+          const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
+          for (Index i=0; i<g_f.Dim(); i++) {
+            values[i] = full_grad_f_[x_pos[i]];
+          }
+        }
+        else {
+          IpBlasDcopy(n_full_x_, full_grad_f_, 1, values, 1);
+        }
+        retvalue = true;
+      }
+    }
+    else if (IsValid(P_x_full_x_)) {
       Number* full_grad_f = new Number[n_full_x_];
-      if (tnlp_->eval_grad_f(n_full_x_, full_x_, new_x, full_grad_f)) {
+      if (tnlp_->eval_grad_f(n_full_x_, x_eval_, new_x, full_grad_f)) {
         const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
         for (Index i=0; i<g_f.Dim(); i++) {
           values[i] = full_grad_f[x_pos[i]];
@@ -1611,7 +1915,7 @@ namespace Ipopt
       delete [] full_grad_f;
     }
     else {
-      retvalue = tnlp_->eval_grad_f(n_full_x_, full_x_, new_x, values);
+      retvalue = tnlp_->eval_grad_f(n_full_x_, x_eval_, new_x, values);
     }
 
     return retvalue;
@@ -1624,6 +1928,20 @@ namespace Ipopt
       new_x = true;
     }
 
+    if (direct_g_) {
+      if (c.Dim() == 0) {
+        return true;
+      }
+      DenseVector* dc = static_cast<DenseVector*>(&c);
+      DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
+      Number* values = dc->Values();
+      if (!tnlp_->eval_g(n_full_x_, x_eval_, new_x, n_full_g_, values)) {
+        return false;
+      }
+      IpBlasDaxpy(n_full_g_, -1., c_rhs_, 1, values, 1);
+      return true;
+    }
+
     if (internal_eval_g(new_x)) {
       DenseVector* dc = static_cast<DenseVector*>(&c);
       DBG_ASSERT(dynamic_cast<DenseVector*>(&c));
@@ -1637,7 +1955,7 @@ namespace Ipopt
       if (fixed_variable_treatment_==MAKE_CONSTRAINT) {
         for (Index i=0; i<n_x_fixed_; i++) {
           values[n_c_no_fixed+i] =
-            full_x_[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed+i];
+            x_eval_[x_fixed_map_[i]] - c_rhs_[n_c_no_fixed+i];
         }
       }
       return true;
@@ -1653,6 +1971,17 @@ namespace Ipopt
       new_x = true;
     }
 
+    if (direct_g_) {
+      if (jac_c.NRows() == 0) {
+        return true;
+      }
+      GenTMatrix* gt_jac_c = static_cast<GenTMatrix*>(&jac_c);
+      DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_c));
+      return tnlp_->eval_jac_g(n_full_x_, x_eval_, new_x, n_full_g_,
+                               nz_full_jac_g_, NULL, NULL,
+                               gt_jac_c->Values());
+    }
+
     if (internal_eval_jac_g(new_x)) {
       GenTMatrix* gt_jac_c = static_cast<GenTMatrix*>(&jac_c);
       DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_c));
@@ -1678,9 +2007,16 @@ namespace Ipopt
       new_x = true;
     }
 
+    if (direct_g_ && d.Dim() == 0) {
+      return true;
+    }
+
     DenseVector* dd = static_cast<DenseVector*>(&d);
     DBG_ASSERT(dynamic_cast<DenseVector*>(&d));
     Number* values = dd->Values();
+    if (direct_g_) {
+      return tnlp_->eval_g(n_full_x_, x_eval_, new_x, n_full_g_, values);
+    }
     if (internal_eval_g(new_x)) {
       const Index* d_pos = P_d_g_->ExpandedPosIndices();
       for (Index i=0; i<d.Dim(); i++) {
@@ -1699,6 +2035,17 @@ namespace Ipopt
       new_x = true;
     }
 
+    if (direct_g_) {
+      if (jac_d.NRows() == 0) {
+        return true;
+      }
+      GenTMatrix* gt_jac_d = static_cast<GenTMatrix*>(&jac_d);
+      DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_d));
+      return tnlp_->eval_jac_g(n_full_x_, x_eval_, new_x, n_full_g_,
+                               nz_full_jac_g_, NULL, NULL,
+                               gt_jac_d->Values());
+    }
+
     if (internal_eval_jac_g(new_x)) {
       GenTMatrix* gt_jac_d = static_cast<GenTMatrix*>(&jac_d);
       DBG_ASSERT(dynamic_cast<GenTMatrix*>(&jac_d));
@@ -1747,10 +2094,26 @@ namespace Ipopt
     DBG_ASSERT(dynamic_cast<SymTMatrix*>(&h));
     Number* values = st_h->Values();
 
-    if (h_idx_map_) {
+    if (eval_all_) {
+      Number* hess_values = h_idx_map_ ? new Number[nz_full_h_] : values;
+      Number dummy_f;
+      retval = tnlp_->eval_all(n_full_x_, x_eval_, new_x, TNLP::EVAL_H,
+                               dummy_f, NULL, n_full_g_, NULL,
+                               nz_full_jac_g_, NULL, obj_factor,
+                               full_lambda_, new_y, nz_full_h_, hess_values);
+      if (h_idx_map_) {
+        if (retval) {
+          for (Index i=0; i<nz_h_; i++) {
+            values[i] = hess_values[h_idx_map_[i]];
+          }
+        }
+        delete [] hess_values;
+      }
+    }
+    else if (h_idx_map_) {
       Number* full_h = new Number[nz_full_h_];
 
-      if (tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_,
+      if (tnlp_->eval_h(n_full_x_, x_eval_, new_x, obj_factor, n_full_g_,
                         full_lambda_, new_y, nz_full_h_, NULL, NULL, full_h)) {
         for (Index i=0; i<nz_h_; i++) {
           values[i] = full_h[h_idx_map_[i]];
@@ -1760,7 +2123,7 @@ namespace Ipopt
       delete [] full_h;
     }
     else {
-      retval = tnlp_->eval_h(n_full_x_, full_x_, new_x, obj_factor, n_full_g_,
+      retval = tnlp_->eval_h(n_full_x_, x_eval_, new_x, obj_factor, n_full_g_,
                              full_lambda_, new_y, nz_full_h_, NULL, NULL,
                              values);
     }
@@ -1768,6 +2131,63 @@ namespace Ipopt
     return retval;
   }
 
+  bool TNLPAdapter::Eval_h_prod(const Vector& x,
+                                Number obj_factor,
+                                const Vector& yc,
+                                const Vector& yd,
+                                const Vector& v,
+                                Vector& h_v)
+  {
+    bool new_x = false;
+    if (update_local_x(x)) {
+      new_x = true;
+    }
+    bool new_y = false;
+    if (update_local_lambda(yc, yd)) {
+      new_y = true;
+    }
+
+    // Expand v to the full space; the entries for the fixed
+    // variables are zero
+    Number* full_v = new Number[n_full_x_];
+    ResortX(v, full_v);
+    if (IsValid(P_x_full_x_)) {
+      const Index* x_pos = P_x_full_x_->CompressedPosIndices();
+      for (Index i=0; i<n_full_x_; i++) {
+        if (x_pos[i] == -1) {
+          full_v[i] = 0.;
+        }
+      }
+    }
+
+    DenseVector* dh_v = static_cast<DenseVector*>(&h_v);
+    DBG_ASSERT(dynamic_cast<DenseVector*>(&h_v));
+    Number* values = dh_v->Values();
+
+    bool retval;
+    if (IsValid(P_x_full_x_)) {
+      Number* full_h_v = new Number[n_full_x_];
+      retval = tnlp_->eval_h_prod(n_full_x_, x_eval_, new_x, obj_factor,
+                                  n_full_g_, full_lambda_, new_y, full_v,
+                                  full_h_v);
+      if (retval) {
+        const Index* x_pos = P_x_full_x_->ExpandedPosIndices();
+        for (Index i=0; i<h_v.Dim(); i++) {
+          values[i] = full_h_v[x_pos[i]];
+        }
+      }
+      delete [] full_h_v;
+    }
+    else {
+      retval = tnlp_->eval_h_prod(n_full_x_, x_eval_, new_x, obj_factor,
+                                  n_full_g_, full_lambda_, new_y, full_v,
+                                  values);
+    }
+    delete [] full_v;
+
+    return retval;
+  }
+
   void TNLPAdapter::GetScalingParameters(
     const SmartPtr<const VectorSpace> x_space,
     const SmartPtr<const VectorSpace> c_space,
@@ -2014,6 +2434,14 @@ namespace Ipopt
                              n_full_g_, full_g, full_lambda_,
                              obj_value, ip_data, ip_cq);
 
+    if (warm_start_previous_solution_ || keep_solution_) {
+      // Keep the solution as starting point for the next run
+      prev_x_.assign(full_x_, full_x_ + n_full_x_);
+      prev_z_L_.assign(full_z_L, full_z_L + n_full_x_);
+      prev_z_U_.assign(full_z_U, full_z_U + n_full_x_);
+      prev_lambda_.assign(full_lambda_, full_lambda_ + n_full_g_);
+    }
+
     delete [] full_z_L;
     full_z_L = NULL;
     delete [] full_z_U;
@@ -2324,7 +2752,20 @@ namespace Ipopt
       return false;
     }
 
-    ResortX(x, full_x_);
+    const DenseVector* dx = static_cast<const DenseVector*>(&x);
+    DBG_ASSERT(dynamic_cast<const DenseVector*>(&x));
+    if (IsNull(P_x_full_x_) && !dx->IsHomogeneous()) {
+      // No variables have been removed, so that the TNLP can be
+      // evaluated directly at the values of x.  We keep a reference
+      // to x so that its values are not freed.
+      x_eval_vector_ = &x;
+      x_eval_ = dx->Values();
+    }
+    else {
+      ResortX(x, full_x_);
+      x_eval_vector_ = NULL;
+      x_eval_ = full_x_;
+    }
 
     x_tag_for_iterates_ = x.GetTag();
 
@@ -2353,9 +2794,14 @@ namespace Ipopt
       return true;
     }
 
+    if (eval_all_) {
+      // The objective function is needed at the same point
+      return internal_eval_all(TNLP::EVAL_F | TNLP::EVAL_G, new_x);
+    }
+
     x_tag_for_g_ = x_tag_for_iterates_;
 
-    bool retval = tnlp_->eval_g(n_full_x_, full_x_, new_x, n_full_g_, full_g_);
+    bool retval = tnlp_->eval_g(n_full_x_, x_eval_, new_x, n_full_g_, full_g_);
 
     if (!retval) {
       x_tag_for_jac_g_ = 0;
@@ -2371,11 +2817,18 @@ namespace Ipopt
       return true;
     }
 
+    if (eval_all_ && jacobian_approximation_ == JAC_EXACT) {
+      // The point has been accepted, so that the gradient of the
+      // objective is needed as well
+      return internal_eval_all(TNLP::EVAL_F | TNLP::EVAL_G |
+                               TNLP::EVAL_GRAD_F | TNLP::EVAL_JAC_G, new_x);
+    }
+
     x_tag_for_jac_g_ = x_tag_for_iterates_;
 
     bool retval;
     if (jacobian_approximation_ == JAC_EXACT) {
-      retval = tnlp_->eval_jac_g(n_full_x_, full_x_, new_x, n_full_g_,
+      retval = tnlp_->eval_jac_g(n_full_x_, x_eval_, new_x, n_full_g_,
                                  nz_full_jac_g_, NULL, NULL, jac_g_);
     }
     else {
@@ -2384,21 +2837,31 @@ namespace Ipopt
       if (retval) {
         Number* full_g_pert = new Number[n_full_g_];
         Number* full_x_pert = new Number[n_full_x_];
-        IpBlasDcopy(n_full_x_, full_x_, 1, full_x_pert, 1);
+        IpBlasDcopy(n_full_x_, x_eval_, 1, full_x_pert, 1);
         // Compute the finite difference Jacobian
         for (Index ivar = 0; ivar<n_full_x_; ivar++) {
           if (findiff_x_l_[ivar] < findiff_x_u_[ivar]) {
             const Number xorig = full_x_pert[ivar];
             Number this_perturbation =
-              findiff_perturbation_*Max(1., fabs(full_x_[ivar]));
+              findiff_perturbation_*Max(1., fabs(x_eval_[ivar]));
             full_x_pert[ivar] += this_perturbation;
             if (full_x_pert[ivar] > findiff_x_u_[ivar]) {
               // if at upper bound, then change direction towards lower bound
               this_perturbation = -this_perturbation;
               full_x_pert[ivar] = xorig + this_perturbation;
             }
-            retval = tnlp_->eval_g(n_full_x_, full_x_pert, true, n_full_g_,
-                                   full_g_pert);
+            if (eval_all_) {
+              Number dummy_f;
+              retval = tnlp_->eval_all(n_full_x_, full_x_pert, true,
+                                       TNLP::EVAL_G, dummy_f, NULL,
+                                       n_full_g_, full_g_pert,
+                                       nz_full_jac_g_, NULL, 0., NULL,
+                                       false, nz_full_h_, NULL);
+            }
+            else {
+              retval = tnlp_->eval_g(n_full_x_, full_x_pert, true, n_full_g_,
+                                     full_g_pert);
+            }
             if (!retval) break;
             for (Index i=findiff_jac_ia_[ivar]; i<findiff_jac_ia_[ivar+1]; i++) {
               const Index& icon = findiff_jac_ja_[i];
@@ -2421,6 +2884,57 @@ namespace Ipopt
     return retval;
   }
 
+  bool TNLPAdapter::internal_eval_all(Index request, bool new_x)
+  {
+    DBG_ASSERT(eval_all_);
+
+    // Skip the quantities that are already known at this point
+    if (x_tag_for_f_ == x_tag_for_iterates_) {
+      request &= ~TNLP::EVAL_F;
+    }
+    if (x_tag_for_g_ == x_tag_for_iterates_) {
+      request &= ~TNLP::EVAL_G;
+    }
+    if (x_tag_for_grad_f_ == x_tag_for_iterates_) {
+      request &= ~TNLP::EVAL_GRAD_F;
+    }
+    if (x_tag_for_jac_g_ == x_tag_for_iterates_) {
+      request &= ~TNLP::EVAL_JAC_G;
+    }
+    if (request == 0) {
+      // already calculated!
+      return true;
+    }
+
+    Number obj_value;
+    bool retval =
+      tnlp_->eval_all(n_full_x_, x_eval_, new_x, request, obj_value,
+                      (request & TNLP::EVAL_GRAD_F) ? full_grad_f_ : NULL,
+                      n_full_g_, (request & TNLP::EVAL_G) ? full_g_ : NULL,
+                      nz_full_jac_g_,
+                      (request & TNLP::EVAL_JAC_G) ? jac_g_ : NULL,
+                      0., NULL, false, nz_full_h_, NULL);
+
+    // If the evaluation failed, none of the requested quantities is
+    // considered to be known at this point
+    const TaggedObject::Tag tag = retval ? x_tag_for_iterates_ : 0;
+    if (request & TNLP::EVAL_F) {
+      full_f_ = obj_value;
+      x_tag_for_f_ = tag;
+    }
+    if (request & TNLP::EVAL_G) {
+      x_tag_for_g_ = tag;
+    }
+    if (request & TNLP::EVAL_GRAD_F) {
+      x_tag_for_grad_f_ = tag;
+    }
+    if (request & TNLP::EVAL_JAC_G) {
+      x_tag_for_jac_g_ = tag;
+    }
+
+    return retval;
+  }
+
   void
   TNLPAdapter::initialize_findiff_jac(const Index* iRow, const Index* jCol)
   {
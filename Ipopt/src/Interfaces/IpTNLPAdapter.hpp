@@ -118,6 +118,13 @@ namespace Ipopt
                         const Vector& yd,
                         SymMatrix& h);
 
+    virtual bool Eval_h_prod(const Vector& x,
+                             Number obj_factor,
+                             const Vector& yc,
+                             const Vector& yd,
+                             const Vector& v,
+                             Vector& h_v);
+
     virtual void GetScalingParameters(
       const SmartPtr<const VectorSpace> x_space,
       const SmartPtr<const VectorSpace> c_space,
@@ -194,6 +201,51 @@ namespace Ipopt
       return tnlp_;
     }
 
+    /** Replace the underlying TNLP by a different one, keeping all
+     *  internal data structures.  The new TNLP must have the same
+     *  structure as the previous one (number of variables and
+     *  constraints, fixed variables, and position of nonzeros in
+     *  Jacobian and Hessian); only the dimensions are checked here,
+     *  see HasSameStructure for the complete check. */
+    void SetTNLP(const SmartPtr<TNLP>& tnlp);
+
+    /** Check whether the given TNLP has the same structure as the
+     *  TNLP for which the spaces have been created most recently,
+     *  i.e., the same problem dimensions, the same fixed variables,
+     *  the same finite bounds on variables and constraints, and the
+     *  same positions of nonzeros in the Jacobian and (if exact
+     *  second derivatives are used) in the Hessian.  If this is the
+     *  case, tnlp can be solved with SetTNLP and
+     *  warm_start_same_structure.  Returns false if no spaces have
+     *  been created yet, or if linearly dependent constraints are
+     *  detected, since the structure then depends on the values of
+     *  the Jacobian. */
+    bool HasSameStructure(const SmartPtr<TNLP>& tnlp) const;
+
+    /** Provide a primal-dual starting point (in the ordering of the
+     *  TNLP) that is used instead of the one returned by
+     *  TNLP::get_starting_point.  Passing empty vectors restores the
+     *  default behavior. */
+    void SetStartingPoint(const std::vector<Number>& x,
+                          const std::vector<Number>& z_L,
+                          const std::vector<Number>& z_U,
+                          const std::vector<Number>& lambda);
+
+    /** Request that the final primal-dual solution is kept in this
+     *  object, so that it can be obtained with GetSolution. */
+    void SetKeepSolution(bool keep_solution)
+    {
+      keep_solution_ = keep_solution;
+    }
+
+    /** Obtain the primal-dual solution (in the ordering of the TNLP)
+     *  of the most recent run.  Returns false if no solution has
+     *  been kept, see SetKeepSolution. */
+    bool GetSolution(std::vector<Number>& x,
+                     std::vector<Number>& z_L,
+                     std::vector<Number>& z_U,
+                     std::vector<Number>& lambda) const;
+
     /** @name Methods for translating data for IpoptNLP into the TNLP
      *  data.  These methods are used to obtain the current (or
      *  final) data for the TNLP formulation from the IpoptNLP
@@ -231,6 +283,12 @@ namespace Ipopt
                                        Index n_c, const Index* c_map,
                                        std::list<Index>& c_deps);
 
+    /** Compute the data that determines the structure of the spaces
+     *  for tnlp (see HasSameStructure).  Returns false if the TNLP
+     *  does not provide the information. */
+    bool ComputeStructureSignature(const SmartPtr<TNLP>& tnlp,
+                                   std::vector<Index>& signature) const;
+
     /** Pointer to the TNLP class (class specific to Number* vectors and
      *  harwell triplet matrices) */
     SmartPtr<TNLP> tnlp_;
@@ -275,6 +333,9 @@ namespace Ipopt
     bool warm_start_same_structure_;
     /** Flag indicating what Hessian information is to be used. */
     HessianApproximationType hessian_approximation_;
+    /** Flag indicating whether only products with the exact Hessian
+     *  are computed, so that its structure is never requested. */
+    bool hessian_vector_products_;
     /** Number of linear variables. */
     Index num_linear_variables_;
     /** Flag indicating how Jacobian is computed. */
@@ -287,10 +348,56 @@ namespace Ipopt
      *  detection */
     bool dependency_detection_with_rhs_;
 
+    /** Flag indicating whether the quantities are computed with
+     *  TNLP::eval_all */
+    bool eval_all_;
     /** Overall convergence tolerance */
     Number tol_;
+    /** Flag indicating whether the starting point is taken from the
+     *  previous solution */
+    bool warm_start_previous_solution_;
+    /** Shift of the previous solution for the variables */
+    Index warm_start_shift_x_;
+    /** Shift of the previous solution for the constraint
+     *  multipliers */
+    Index warm_start_shift_g_;
     //@}
 
+    /** Flag indicating whether the final solution is kept even if
+     *  warm_start_previous_solution_ is false */
+    bool keep_solution_;
+
+    /** Structure signature (see ComputeStructureSignature) of the
+     *  TNLP for which the spaces have been created; empty if not
+     *  available. */
+    std::vector<Index> structure_signature_;
+
+    /** @name Starting point set by SetStartingPoint (in the TNLP
+     *  ordering); empty if the TNLP provides the starting point */
+    //@{
+    std::vector<Number> start_x_;
+    std::vector<Number> start_z_L_;
+    std::vector<Number> start_z_U_;
+    std::vector<Number> start_lambda_;
+    //@}
+
+    /** @name Solution of the previous run (in the TNLP ordering),
+     *  kept if warm_start_previous_solution_ or keep_solution_ is
+     *  true */
+    //@{
+    std::vector<Number> prev_x_;
+    std::vector<Number> prev_z_L_;
+    std::vector<Number> prev_z_U_;
+    std::vector<Number> prev_lambda_;
+    //@}
+
+    /** Copy values of the previous solution, shifted by shift
+     *  positions, into values.  The last shift entries keep their
+     *  previous values. */
+    static void ShiftValues(Index n, Index shift,
+                            const std::vector<Number>& prev,
+                            Number* values);
+
     /**@name Problem Size Data */
     //@{
     /** full dimension of x (fixed + non-fixed) */
@@ -338,9 +445,13 @@ namespace Ipopt
     /**@name Local Copy of the Data */
     //@{
     Number* full_x_; /** copy of the full x vector (fixed & non-fixed) */
+    const Number* x_eval_; /** current point passed to the TNLP; either
+                            *  full_x_ or the values of x_eval_vector_ */
     Number* full_lambda_; /** copy of lambda (yc & yd) */
     Number* full_g_; /** copy of g (c & d) */
     Number* jac_g_; /** the values for the full jacobian of g */
+    Number full_f_; /** value of the objective function (if eval_all_) */
+    Number* full_grad_f_; /** full gradient of f (if eval_all_) */
     Number* c_rhs_; /** the rhs values of c */
     //@}
 
@@ -351,8 +462,21 @@ namespace Ipopt
     TaggedObject::Tag y_d_tag_for_iterates_;
     TaggedObject::Tag x_tag_for_g_;
     TaggedObject::Tag x_tag_for_jac_g_;
+    TaggedObject::Tag x_tag_for_f_;
+    TaggedObject::Tag x_tag_for_grad_f_;
     //@}
 
+    /** Current iterate, if its values are passed directly to the
+     *  TNLP (when no variables have been removed) */
+    SmartPtr<const Vector> x_eval_vector_;
+
+    /** Flag indicating whether the values of g and its Jacobian are
+     *  computed directly into the storage of c or d and their
+     *  Jacobian.  This is the case if no variables or constraints
+     *  have been removed, all constraints are either equality or
+     *  inequality constraints, and the Jacobian is exact. */
+    bool direct_g_;
+
     /**@name Methods to update the values in the local copies of vectors */
     //@{
     bool update_local_x(const Vector& x);
@@ -364,6 +488,12 @@ namespace Ipopt
     //@{
     bool internal_eval_g(bool new_x);
     bool internal_eval_jac_g(bool new_x);
+    /** Compute the quantities in request (a combination of
+     *  TNLP::EvalAllRequest flags) at the current point with one call
+     *  of TNLP::eval_all, omitting those that are already known at
+     *  this point.  The results are stored in full_f_, full_g_,
+     *  full_grad_f_, and jac_g_. */
+    bool internal_eval_all(Index request, bool new_x);
     //@}
 
     /** @name Internal methods for dealing with finite difference
@@ -0,0 +1,576 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpTNLPDecomposition.hpp"
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  TNLPDecomposition::TNLPDecomposition(TNLP& tnlp)
+      :
+      tnlp_(&tnlp),
+      n_(-1),
+      m_(-1),
+      nnz_jac_g_(-1),
+      nnz_h_lag_(-1),
+      index_style_(TNLP::C_STYLE),
+      last_comp_(-1)
+  {}
+
+  TNLPDecomposition::~TNLPDecomposition()
+  {}
+
+  Index TNLPDecomposition::FindRoot(std::vector<Index>& parent, Index i) const
+  {
+    Index root = i;
+    while (parent[root] != root) {
+      root = parent[root];
+    }
+    // path compression
+    while (parent[i] != root) {
+      Index next = parent[i];
+      parent[i] = root;
+      i = next;
+    }
+    return root;
+  }
+
+  Index TNLPDecomposition::Analyze(Index min_block_size)
+  {
+    DBG_START_METH("TNLPDecomposition::Analyze", dbg_verbosity);
+
+    comp_vars_.clear();
+    comp_cons_.clear();
+    comp_jac_.clear();
+    comp_h_.clear();
+
+    if (!tnlp_->get_nlp_info(n_, m_, nnz_jac_g_, nnz_h_lag_, index_style_)) {
+      return 1;
+    }
+    if (n_ == 0) {
+      return 1;
+    }
+    const Index offset = (index_style_ == TNLP::FORTRAN_STYLE) ? 1 : 0;
+
+    // Get the structure of the Jacobian and of the Hessian.  If the
+    // Hessian structure is not available, the objective might couple
+    // all variables and we cannot decompose the problem.
+    jac_iRow_.resize(nnz_jac_g_);
+    jac_jCol_.resize(nnz_jac_g_);
+    if (nnz_jac_g_ > 0 &&
+        !tnlp_->eval_jac_g(n_, NULL, false, m_, nnz_jac_g_,
+                           &jac_iRow_[0], &jac_jCol_[0], NULL)) {
+      return 1;
+    }
+    // Note that eval_h is called even if there are no Hessian
+    // elements, since a TNLP that does not implement eval_h might
+    // report zero elements.
+    h_iRow_.resize(nnz_h_lag_+1);
+    h_jCol_.resize(nnz_h_lag_+1);
+    if (!tnlp_->eval_h(n_, NULL, false, 0., m_, NULL, false, nnz_h_lag_,
+                       &h_iRow_[0], &h_jCol_[0], NULL)) {
+      return 1;
+    }
+    h_iRow_.resize(nnz_h_lag_);
+    h_jCol_.resize(nnz_h_lag_);
+    for (Index i=0; i<nnz_jac_g_; i++) {
+      jac_iRow_[i] -= offset;
+      jac_jCol_[i] -= offset;
+    }
+    for (Index i=0; i<nnz_h_lag_; i++) {
+      h_iRow_[i] -= offset;
+      h_jCol_[i] -= offset;
+    }
+
+    // Union-find over the variables: two variables are connected if
+    // they appear in the same constraint or in the same Hessian element
+    std::vector<Index> parent(n_);
+    for (Index i=0; i<n_; i++) {
+      parent[i] = i;
+    }
+    std::vector<Index> row_var(m_, -1);
+    for (Index i=0; i<nnz_jac_g_; i++) {
+      Index row = jac_iRow_[i];
+      Index col = jac_jCol_[i];
+      if (row_var[row] == -1) {
+        row_var[row] = col;
+      }
+      else {
+        Index r1 = FindRoot(parent, row_var[row]);
+        Index r2 = FindRoot(parent, col);
+        if (r1 != r2) {
+          parent[r2] = r1;
+        }
+      }
+    }
+    for (Index i=0; i<nnz_h_lag_; i++) {
+      Index r1 = FindRoot(parent, h_iRow_[i]);
+      Index r2 = FindRoot(parent, h_jCol_[i]);
+      if (r1 != r2) {
+        parent[r2] = r1;
+      }
+    }
+
+    // Number of variables and constraints in each connected
+    // component, identified by its root.  Constraints without any
+    // nonzero are counted for the component of the first variable.
+    std::vector<Index> root_size(n_, 0);
+    for (Index i=0; i<n_; i++) {
+      root_size[FindRoot(parent, i)]++;
+    }
+    for (Index j=0; j<m_; j++) {
+      Index var = (row_var[j] == -1) ? 0 : row_var[j];
+      root_size[FindRoot(parent, var)]++;
+    }
+
+    // Number the components in the order of their first variable.
+    // Connected components that are smaller than min_block_size are
+    // all put into one component, since a separate optimization run
+    // for each of them would cost more than it saves.
+    std::vector<Index> root_comp(n_, -1);
+    Index merged_comp = -1;
+    var_comp_.resize(n_);
+    var_pos_.resize(n_);
+    for (Index i=0; i<n_; i++) {
+      Index root = FindRoot(parent, i);
+      if (root_comp[root] == -1) {
+        if (root_size[root] < min_block_size) {
+          if (merged_comp == -1) {
+            merged_comp = (Index)comp_vars_.size();
+            comp_vars_.push_back(std::vector<Index>());
+          }
+          root_comp[root] = merged_comp;
+        }
+        else {
+          root_comp[root] = (Index)comp_vars_.size();
+          comp_vars_.push_back(std::vector<Index>());
+        }
+      }
+      Index k = root_comp[root];
+      var_comp_[i] = k;
+      var_pos_[i] = (Index)comp_vars_[k].size();
+      comp_vars_[k].push_back(i);
+    }
+    const Index ncomp = (Index)comp_vars_.size();
+
+    // Constraints belong to the component of their variables.
+    // Constraints without any nonzero are put into the first component.
+    comp_cons_.resize(ncomp);
+    con_comp_.resize(m_);
+    con_pos_.resize(m_);
+    for (Index j=0; j<m_; j++) {
+      Index k = (row_var[j] == -1) ? 0 : var_comp_[row_var[j]];
+      con_comp_[j] = k;
+      con_pos_[j] = (Index)comp_cons_[k].size();
+      comp_cons_[k].push_back(j);
+    }
+
+    comp_jac_.resize(ncomp);
+    for (Index i=0; i<nnz_jac_g_; i++) {
+      comp_jac_[var_comp_[jac_jCol_[i]]].push_back(i);
+    }
+    comp_h_.resize(ncomp);
+    for (Index i=0; i<nnz_h_lag_; i++) {
+      comp_h_[var_comp_[h_iRow_[i]]].push_back(i);
+    }
+
+    if (ncomp == 1) {
+      return 1;
+    }
+
+    // Retrieve the bounds and the starting point, which are used as
+    // values for the variables outside of the current component
+    x_l_.resize(n_);
+    x_u_.resize(n_);
+    g_l_.resize(m_);
+    g_u_.resize(m_);
+    full_x_.resize(n_);
+    if (!tnlp_->get_bounds_info(n_, &x_l_[0], &x_u_[0], m_,
+                                m_>0 ? &g_l_[0] : NULL,
+                                m_>0 ? &g_u_[0] : NULL)) {
+      return 1;
+    }
+    std::vector<Number> z_dummy(n_);
+    std::vector<Number> lam_dummy(m_);
+    if (!tnlp_->get_starting_point(n_, true, &full_x_[0], false,
+                                   &z_dummy[0], &z_dummy[0], m_, false,
+                                   m_>0 ? &lam_dummy[0] : NULL)) {
+      return 1;
+    }
+    last_comp_ = -1;
+
+    work_x_.resize(n_);
+    work_z_L_.resize(n_);
+    work_z_U_.resize(n_);
+    work_g_.resize(m_);
+    work_lambda_.resize(m_);
+    work_jac_.resize(nnz_jac_g_);
+    work_h_.resize(nnz_h_lag_);
+
+    x_sol_ = full_x_;
+    z_L_sol_.assign(n_, 0.);
+    z_U_sol_.assign(n_, 0.);
+    lambda_sol_.assign(m_, 0.);
+    comp_status_.assign(ncomp, INTERNAL_ERROR);
+
+    return ncomp;
+  }
+
+  SmartPtr<TNLP> TNLPDecomposition::Component(Index k)
+  {
+    DBG_ASSERT(k >= 0 && k < NumComponents());
+    return new TNLPComponent(*this, k);
+  }
+
+  bool TNLPDecomposition::ScatterX(Index k, const Number* x_comp, bool new_x)
+  {
+    if (new_x || last_comp_ != k) {
+      const std::vector<Index>& vars = comp_vars_[k];
+      for (Index i=0; i<(Index)vars.size(); i++) {
+        full_x_[vars[i]] = x_comp[i];
+      }
+      last_comp_ = k;
+      return true;
+    }
+    return false;
+  }
+
+  SolverReturn TNLPDecomposition::FinalizeSolution(Number& obj_value)
+  {
+    SolverReturn status = SUCCESS;
+    for (Index k=0; k<NumComponents(); k++) {
+      if (comp_status_[k] != SUCCESS) {
+        status = comp_status_[k];
+        break;
+      }
+    }
+
+    std::vector<Number> g(m_);
+    last_comp_ = -1;
+    obj_value = 0.;
+    tnlp_->eval_f(n_, &x_sol_[0], true, obj_value);
+    if (m_ > 0) {
+      tnlp_->eval_g(n_, &x_sol_[0], false, m_, &g[0]);
+    }
+
+    // There is no IpoptData for the complete problem; the data of a
+    // single component would live in the reduced space of that
+    // component, so ip_data and ip_cq are NULL (as documented).
+    tnlp_->finalize_solution(status, n_, &x_sol_[0], &z_L_sol_[0],
+                             &z_U_sol_[0], m_, m_>0 ? &g[0] : NULL,
+                             m_>0 ? &lambda_sol_[0] : NULL, obj_value,
+                             NULL, NULL);
+    return status;
+  }
+
+  TNLPComponent::TNLPComponent(TNLPDecomposition& decomp, Index comp)
+      :
+      decomp_(&decomp),
+      comp_(comp)
+  {}
+
+  TNLPComponent::~TNLPComponent()
+  {}
+
+  bool
+  TNLPComponent::get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
+                              Index& nnz_h_lag, IndexStyleEnum& index_style)
+  {
+    n = (Index)decomp_->comp_vars_[comp_].size();
+    m = (Index)decomp_->comp_cons_[comp_].size();
+    nnz_jac_g = (Index)decomp_->comp_jac_[comp_].size();
+    nnz_h_lag = (Index)decomp_->comp_h_[comp_].size();
+    index_style = C_STYLE;
+    return true;
+  }
+
+  bool
+  TNLPComponent::get_bounds_info(Index n, Number* x_l, Number* x_u,
+                                 Index m, Number* g_l, Number* g_u)
+  {
+    const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+    for (Index i=0; i<n; i++) {
+      x_l[i] = decomp_->x_l_[vars[i]];
+      x_u[i] = decomp_->x_u_[vars[i]];
+    }
+    const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+    for (Index j=0; j<m; j++) {
+      g_l[j] = decomp_->g_l_[cons[j]];
+      g_u[j] = decomp_->g_u_[cons[j]];
+    }
+    return true;
+  }
+
+  bool
+  TNLPComponent::get_scaling_parameters(Number& obj_scaling,
+                                        bool& use_x_scaling, Index n,
+                                        Number* x_scaling,
+                                        bool& use_g_scaling, Index m,
+                                        Number* g_scaling)
+  {
+    const Index n_full = decomp_->n_;
+    const Index m_full = decomp_->m_;
+    Number* x_scaling_full = &decomp_->work_x_[0];
+    Number* g_scaling_full = m_full>0 ? &decomp_->work_g_[0] : NULL;
+    bool retval =
+      decomp_->tnlp_->get_scaling_parameters(obj_scaling,
+                                             use_x_scaling, n_full, x_scaling_full,
+                                             use_g_scaling, m_full,
+                                             g_scaling_full);
+    if (!retval) {
+      return false;
+    }
+    if (use_x_scaling) {
+      const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+      for (Index i=0; i<n; i++) {
+        x_scaling[i] = x_scaling_full[vars[i]];
+      }
+    }
+    if (use_g_scaling) {
+      const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+      for (Index j=0; j<m; j++) {
+        g_scaling[j] = g_scaling_full[cons[j]];
+      }
+    }
+    return true;
+  }
+
+  bool
+  TNLPComponent::get_variables_linearity(Index n, LinearityType* var_types)
+  {
+    std::vector<LinearityType> types(decomp_->n_);
+    bool retval = decomp_->tnlp_->get_variables_linearity(decomp_->n_,
+                  &types[0]);
+    if (retval) {
+      const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+      for (Index i=0; i<n; i++) {
+        var_types[i] = types[vars[i]];
+      }
+    }
+    return retval;
+  }
+
+  bool
+  TNLPComponent::get_constraints_linearity(Index m, LinearityType* const_types)
+  {
+    if (decomp_->m_ == 0) {
+      return true;
+    }
+    std::vector<LinearityType> types(decomp_->m_);
+    bool retval = decomp_->tnlp_->get_constraints_linearity(decomp_->m_,
+                  &types[0]);
+    if (retval) {
+      const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+      for (Index j=0; j<m; j++) {
+        const_types[j] = types[cons[j]];
+      }
+    }
+    return retval;
+  }
+
+  bool
+  TNLPComponent::get_starting_point(Index n, bool init_x, Number* x,
+                                    bool init_z, Number* z_L, Number* z_U,
+                                    Index m, bool init_lambda,
+                                    Number* lambda)
+  {
+    const Index n_full = decomp_->n_;
+    const Index m_full = decomp_->m_;
+    Number* x_full = &decomp_->work_x_[0];
+    Number* z_L_full = &decomp_->work_z_L_[0];
+    Number* z_U_full = &decomp_->work_z_U_[0];
+    Number* lambda_full = m_full>0 ? &decomp_->work_lambda_[0] : NULL;
+    bool retval =
+      decomp_->tnlp_->get_starting_point(n_full, init_x, x_full,
+                                         init_z, z_L_full, z_U_full,
+                                         m_full, init_lambda, lambda_full);
+    if (!retval) {
+      return false;
+    }
+    const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+    for (Index i=0; i<n; i++) {
+      if (init_x) {
+        x[i] = x_full[vars[i]];
+      }
+      if (init_z) {
+        z_L[i] = z_L_full[vars[i]];
+        z_U[i] = z_U_full[vars[i]];
+      }
+    }
+    if (init_lambda) {
+      const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+      for (Index j=0; j<m; j++) {
+        lambda[j] = lambda_full[cons[j]];
+      }
+    }
+    return true;
+  }
+
+  bool
+  TNLPComponent::eval_f(Index n, const Number* x, bool new_x,
+                        Number& obj_value)
+  {
+    new_x = decomp_->ScatterX(comp_, x, new_x);
+    return decomp_->tnlp_->eval_f(decomp_->n_, &decomp_->full_x_[0], new_x,
+                                  obj_value);
+  }
+
+  bool
+  TNLPComponent::eval_grad_f(Index n, const Number* x, bool new_x,
+                             Number* grad_f)
+  {
+    new_x = decomp_->ScatterX(comp_, x, new_x);
+    Number* grad_f_full = &decomp_->work_x_[0];
+    bool retval = decomp_->tnlp_->eval_grad_f(decomp_->n_,
+                  &decomp_->full_x_[0], new_x,
+                  grad_f_full);
+    if (retval) {
+      const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+      for (Index i=0; i<n; i++) {
+        grad_f[i] = grad_f_full[vars[i]];
+      }
+    }
+    return retval;
+  }
+
+  bool
+  TNLPComponent::eval_g(Index n, const Number* x, bool new_x,
+                        Index m, Number* g)
+  {
+    new_x = decomp_->ScatterX(comp_, x, new_x);
+    Number* g_full = decomp_->m_>0 ? &decomp_->work_g_[0] : NULL;
+    bool retval = decomp_->tnlp_->eval_g(decomp_->n_, &decomp_->full_x_[0],
+                                         new_x, decomp_->m_, g_full);
+    if (retval) {
+      const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+      for (Index j=0; j<m; j++) {
+        g[j] = g_full[cons[j]];
+      }
+    }
+    return retval;
+  }
+
+  bool
+  TNLPComponent::eval_jac_g(Index n, const Number* x, bool new_x,
+                            Index m, Index nele_jac, Index* iRow,
+                            Index *jCol, Number* values)
+  {
+    const std::vector<Index>& elems = decomp_->comp_jac_[comp_];
+    if (iRow) {
+      for (Index i=0; i<nele_jac; i++) {
+        iRow[i] = decomp_->con_pos_[decomp_->jac_iRow_[elems[i]]];
+        jCol[i] = decomp_->var_pos_[decomp_->jac_jCol_[elems[i]]];
+      }
+      return true;
+    }
+
+    new_x = decomp_->ScatterX(comp_, x, new_x);
+    Number* values_full =
+      decomp_->nnz_jac_g_>0 ? &decomp_->work_jac_[0] : NULL;
+    bool retval =
+      decomp_->tnlp_->eval_jac_g(decomp_->n_, &decomp_->full_x_[0], new_x,
+                                 decomp_->m_, decomp_->nnz_jac_g_,
+                                 NULL, NULL, values_full);
+    if (retval) {
+      for (Index i=0; i<nele_jac; i++) {
+        values[i] = values_full[elems[i]];
+      }
+    }
+    return retval;
+  }
+
+  bool
+  TNLPComponent::eval_h(Index n, const Number* x, bool new_x,
+                        Number obj_factor, Index m, const Number* lambda,
+                        bool new_lambda, Index nele_hess,
+                        Index* iRow, Index* jCol, Number* values)
+  {
+    const std::vector<Index>& elems = decomp_->comp_h_[comp_];
+    if (iRow) {
+      for (Index i=0; i<nele_hess; i++) {
+        iRow[i] = decomp_->var_pos_[decomp_->h_iRow_[elems[i]]];
+        jCol[i] = decomp_->var_pos_[decomp_->h_jCol_[elems[i]]];
+      }
+      return true;
+    }
+
+    bool other_comp = (decomp_->last_comp_ != comp_);
+    new_x = decomp_->ScatterX(comp_, x, new_x);
+
+    // The multipliers of the constraints of the other components are
+    // zero, so that they do not contribute to the Hessian entries
+    // of this component
+    Number* lambda_full = decomp_->m_>0 ? &decomp_->work_lambda_[0] : NULL;
+    for (Index j=0; j<decomp_->m_; j++) {
+      lambda_full[j] = 0.;
+    }
+    const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+    for (Index j=0; j<m; j++) {
+      lambda_full[cons[j]] = lambda[j];
+    }
+
+    Number* values_full =
+      decomp_->nnz_h_lag_>0 ? &decomp_->work_h_[0] : NULL;
+    bool retval =
+      decomp_->tnlp_->eval_h(decomp_->n_, &decomp_->full_x_[0], new_x,
+                             obj_factor, decomp_->m_, lambda_full,
+                             new_lambda || other_comp,
+                             decomp_->nnz_h_lag_, NULL, NULL,
+                             values_full);
+    if (retval) {
+      for (Index i=0; i<nele_hess; i++) {
+        values[i] = values_full[elems[i]];
+      }
+    }
+    return retval;
+  }
+
+  void
+  TNLPComponent::finalize_solution(SolverReturn status,
+                                   Index n, const Number* x,
+                                   const Number* z_L, const Number* z_U,
+                                   Index m, const Number* g,
+                                   const Number* lambda,
+                                   Number obj_value,
+                                   const IpoptData* ip_data,
+                                   IpoptCalculatedQuantities* ip_cq)
+  {
+    const std::vector<Index>& vars = decomp_->comp_vars_[comp_];
+    for (Index i=0; i<n; i++) {
+      decomp_->x_sol_[vars[i]] = x[i];
+      decomp_->z_L_sol_[vars[i]] = z_L[i];
+      decomp_->z_U_sol_[vars[i]] = z_U[i];
+    }
+    const std::vector<Index>& cons = decomp_->comp_cons_[comp_];
+    for (Index j=0; j<m; j++) {
+      decomp_->lambda_sol_[cons[j]] = lambda[j];
+    }
+    decomp_->comp_status_[comp_] = status;
+  }
+
+  bool
+  TNLPComponent::intermediate_callback(AlgorithmMode mode,
+                                       Index iter, Number obj_value,
+                                       Number inf_pr, Number inf_du,
+                                       Number mu, Number d_norm,
+                                       Number regularization_size,
+                                       Number alpha_du, Number alpha_pr,
+                                       Index ls_trials,
+                                       const IpoptData* ip_data,
+                                       IpoptCalculatedQuantities* ip_cq)
+  {
+    return decomp_->tnlp_->intermediate_callback(mode, iter, obj_value,
+           inf_pr, inf_du, mu, d_norm,
+           regularization_size,
+           alpha_du, alpha_pr, ls_trials,
+           ip_data, ip_cq);
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,315 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IPTNLPDECOMPOSITION_HPP__
+#define __IPTNLPDECOMPOSITION_HPP__
+
+#include "IpTNLP.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** This class analyzes the sparsity structure of a TNLP and finds
+   *  the groups of variables and constraints that are not coupled
+   *  with each other, neither through the constraint Jacobian nor
+   *  through the Hessian of the Lagrangian.  Each such connected
+   *  component is an independent subproblem; it can be obtained as
+   *  a TNLP of its own with the Component method and solved
+   *  separately.  Connected components that are too small to be
+   *  worth a separate optimization run (e.g., single free variables)
+   *  are merged into one component.  The solutions of the
+   *  components are collected by this object, and FinalizeSolution
+   *  reassembles them and hands them to the original TNLP.
+   *
+   *  IMPORTANT: Since the components are solved by separate
+   *  optimization runs, there are no IpoptData and
+   *  IpoptCalculatedQuantities objects for the complete problem, and
+   *  the arguments ip_data and ip_cq of the finalize_solution call
+   *  for the original TNLP are NULL.  A TNLP that uses them must check
+   *  for NULL, or must not be solved with decompose_independent_blocks.
+   *
+   *  The analysis requires that the structure of the Hessian of the
+   *  Lagrangian is provided by the TNLP (eval_h), since otherwise a
+   *  coupling through the objective function cannot be excluded.
+   *
+   *  The TNLP of a component only works in the variable and
+   *  constraint space of the component; the bounds are extracted
+   *  once by Analyze, and the only full-size data are the work
+   *  arrays of this object, which are shared by all components.
+   *  Since the TNLP interface does not allow evaluating a subset of
+   *  the functions, the function values are still computed by the
+   *  original TNLP at the full vector of variables, where the
+   *  variables not belonging to the component are kept at their
+   *  starting point values.  Therefore, the components must not be
+   *  evaluated concurrently.
+   */
+  class TNLPDecomposition : public ReferencedObject
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Constructor, given the TNLP that should be decomposed. */
+    TNLPDecomposition(TNLP& tnlp);
+
+    /** Default destructor */
+    virtual ~TNLPDecomposition();
+    //@}
+
+    /** Analyze the sparsity structure of the TNLP and compute the
+     *  connected components.  All connected components with fewer
+     *  than min_block_size variables and constraints are merged into
+     *  a single component.  Returns the number of components; the
+     *  return value is 1 if the problem cannot be decomposed (or if
+     *  the structure could not be obtained from the TNLP). */
+    Index Analyze(Index min_block_size);
+
+    /** Number of components found by the most recent call of
+     *  Analyze. */
+    Index NumComponents() const
+    {
+      return (Index)comp_vars_.size();
+    }
+
+    /** Number of variables in component k. */
+    Index NumComponentVariables(Index k) const
+    {
+      return (Index)comp_vars_[k].size();
+    }
+
+    /** Number of constraints in component k. */
+    Index NumComponentConstraints(Index k) const
+    {
+      return (Index)comp_cons_[k].size();
+    }
+
+    /** Create a TNLP for component k.  Its finalize_solution method
+     *  stores the solution of the component in this object. */
+    SmartPtr<TNLP> Component(Index k);
+
+    /** Assemble the solutions of all components and pass them to the
+     *  finalize_solution method of the original TNLP.  The returned
+     *  value is the overall status, which is the status of the first
+     *  component that did not terminate successfully.  The value of
+     *  the objective function at the assembled point is returned in
+     *  obj_value.  The ip_data and ip_cq arguments passed to
+     *  finalize_solution are NULL (see the class description). */
+    SolverReturn FinalizeSolution(Number& obj_value);
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    TNLPDecomposition();
+
+    /** Copy Constructor */
+    TNLPDecomposition(const TNLPDecomposition&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const TNLPDecomposition&);
+    //@}
+
+    friend class TNLPComponent;
+
+    /** Find the representative of the set containing i (for the
+     *  union-find data structure used in Analyze). */
+    Index FindRoot(std::vector<Index>& parent, Index i) const;
+
+    /** Copy the values of the variables of component k from x_comp
+     *  into full_x_.  Returns true, if the TNLP has to be told that
+     *  x is new, which is also the case if the most recent
+     *  evaluation was done for a different component. */
+    bool ScatterX(Index k, const Number* x_comp, bool new_x);
+
+    /** @name original TNLP */
+    //@{
+    SmartPtr<TNLP> tnlp_;
+    Index n_;
+    Index m_;
+    Index nnz_jac_g_;
+    Index nnz_h_lag_;
+    TNLP::IndexStyleEnum index_style_;
+    //@}
+
+    /** @name Sparsity structure of the original TNLP, with 0-based
+     *  indices */
+    //@{
+    std::vector<Index> jac_iRow_;
+    std::vector<Index> jac_jCol_;
+    std::vector<Index> h_iRow_;
+    std::vector<Index> h_jCol_;
+    //@}
+
+    /** @name Component information */
+    //@{
+    /** Component of each variable */
+    std::vector<Index> var_comp_;
+    /** Position of each variable within its component */
+    std::vector<Index> var_pos_;
+    /** Component of each constraint */
+    std::vector<Index> con_comp_;
+    /** Position of each constraint within its component */
+    std::vector<Index> con_pos_;
+    /** Variables in each component, in increasing order */
+    std::vector<std::vector<Index> > comp_vars_;
+    /** Constraints in each component, in increasing order */
+    std::vector<std::vector<Index> > comp_cons_;
+    /** Jacobian elements belonging to each component */
+    std::vector<std::vector<Index> > comp_jac_;
+    /** Hessian elements belonging to each component */
+    std::vector<std::vector<Index> > comp_h_;
+    //@}
+
+    /** @name Bounds and point at which the TNLP is evaluated */
+    //@{
+    std::vector<Number> x_l_;
+    std::vector<Number> x_u_;
+    std::vector<Number> g_l_;
+    std::vector<Number> g_u_;
+    /** Full vector of variables used for the evaluations.  The
+     *  entries not belonging to the currently evaluated component
+     *  are at their starting point values. */
+    std::vector<Number> full_x_;
+    /** Component for which full_x_ was most recently updated, or -1 */
+    Index last_comp_;
+    //@}
+
+    /** @name Work space for the evaluations of the original TNLP,
+     *  shared by all components */
+    //@{
+    std::vector<Number> work_x_;
+    std::vector<Number> work_z_L_;
+    std::vector<Number> work_z_U_;
+    std::vector<Number> work_g_;
+    std::vector<Number> work_lambda_;
+    std::vector<Number> work_jac_;
+    std::vector<Number> work_h_;
+    //@}
+
+    /** @name Assembled solution */
+    //@{
+    std::vector<Number> x_sol_;
+    std::vector<Number> z_L_sol_;
+    std::vector<Number> z_U_sol_;
+    std::vector<Number> lambda_sol_;
+    /** Status reported for each component (INTERNAL_ERROR if a
+     *  component did not report a solution) */
+    std::vector<SolverReturn> comp_status_;
+    //@}
+  };
+
+  /** TNLP for a single component of a TNLPDecomposition, in the
+   *  space of the variables and constraints of the component.  All
+   *  evaluations are delegated to the original TNLP, and the results
+   *  are restricted to the variables and constraints of the
+   *  component. */
+  class TNLPComponent : public TNLP
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Constructor, given the decomposition and the number of the
+     *  component. */
+    TNLPComponent(TNLPDecomposition& decomp, Index comp);
+
+    /** Default destructor */
+    virtual ~TNLPComponent();
+    //@}
+
+    /** @name Overloaded methods from TNLP */
+    virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
+                              Index& nnz_h_lag, IndexStyleEnum& index_style);
+
+    virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u,
+                                 Index m, Number* g_l, Number* g_u);
+
+    virtual bool get_scaling_parameters(Number& obj_scaling,
+                                        bool& use_x_scaling, Index n,
+                                        Number* x_scaling,
+                                        bool& use_g_scaling, Index m,
+                                        Number* g_scaling);
+
+    virtual bool get_variables_linearity(Index n, LinearityType* var_types);
+
+    virtual bool get_constraints_linearity(Index m, LinearityType* const_types);
+
+    virtual bool get_starting_point(Index n, bool init_x, Number* x,
+                                    bool init_z, Number* z_L, Number* z_U,
+                                    Index m, bool init_lambda,
+                                    Number* lambda);
+
+    virtual bool eval_f(Index n, const Number* x, bool new_x,
+                        Number& obj_value);
+
+    virtual bool eval_grad_f(Index n, const Number* x, bool new_x,
+                             Number* grad_f);
+
+    virtual bool eval_g(Index n, const Number* x, bool new_x,
+                        Index m, Number* g);
+
+    virtual bool eval_jac_g(Index n, const Number* x, bool new_x,
+                            Index m, Index nele_jac, Index* iRow,
+                            Index *jCol, Number* values);
+
+    virtual bool eval_h(Index n, const Number* x, bool new_x,
+                        Number obj_factor, Index m, const Number* lambda,
+                        bool new_lambda, Index nele_hess,
+                        Index* iRow, Index* jCol, Number* values);
+
+    virtual void finalize_solution(SolverReturn status,
+                                   Index n, const Number* x, const Number* z_L, const Number* z_U,
+                                   Index m, const Number* g, const Number* lambda,
+                                   Number obj_value,
+                                   const IpoptData* ip_data,
+                                   IpoptCalculatedQuantities* ip_cq);
+
+    virtual bool intermediate_callback(AlgorithmMode mode,
+                                       Index iter, Number obj_value,
+                                       Number inf_pr, Number inf_du,
+                                       Number mu, Number d_norm,
+                                       Number regularization_size,
+                                       Number alpha_du, Number alpha_pr,
+                                       Index ls_trials,
+                                       const IpoptData* ip_data,
+                                       IpoptCalculatedQuantities* ip_cq);
+    //@}
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    TNLPComponent();
+
+    /** Copy Constructor */
+    TNLPComponent(const TNLPComponent&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const TNLPComponent&);
+    //@}
+
+    /** Decomposition this component belongs to */
+    SmartPtr<TNLPDecomposition> decomp_;
+
+    /** Number of this component */
+    Index comp_;
+  };
+
+} // namespace Ipopt
+
+#endif
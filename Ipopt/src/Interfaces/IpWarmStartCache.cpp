@@ -0,0 +1,130 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#include "IpoptConfig.h"
+#include "IpWarmStartCache.hpp"
+#include "IpDebug.hpp"
+
+#ifdef HAVE_CMATH
+# include <cmath>
+#else
+# ifdef HAVE_MATH_H
+#  include <math.h>
+# else
+#  error "don't have header file for math"
+# endif
+#endif
+
+namespace Ipopt
+{
+#if COIN_IPOPT_VERBOSITY > 0
+  static const Index dbg_verbosity = 0;
+#endif
+
+  WarmStartCache::WarmStartCache(Index max_entries)
+      :
+      max_entries_(max_entries),
+      counter_(0)
+  {
+    DBG_ASSERT(max_entries_ > 0);
+  }
+
+  WarmStartCache::~WarmStartCache()
+  {}
+
+  void WarmStartCache::Store(const std::vector<Number>& parameters,
+                             const std::vector<Number>& x,
+                             const std::vector<Number>& z_L,
+                             const std::vector<Number>& z_U,
+                             const std::vector<Number>& lambda,
+                             Number mu)
+  {
+    DBG_START_METH("WarmStartCache::Store", dbg_verbosity);
+
+    // Find the entry to be overwritten: one with identical
+    // parameters, or the least recently used one if the cache is full
+    Index pos = -1;
+    for (Index i=0; i<(Index)entries_.size(); i++) {
+      if (entries_[i].parameters == parameters) {
+        pos = i;
+        break;
+      }
+    }
+    if (pos < 0) {
+      if ((Index)entries_.size() < max_entries_) {
+        pos = (Index)entries_.size();
+        entries_.resize(pos + 1);
+      }
+      else {
+        pos = 0;
+        for (Index i=1; i<(Index)entries_.size(); i++) {
+          if (entries_[i].last_used < entries_[pos].last_used) {
+            pos = i;
+          }
+        }
+      }
+    }
+    DBG_PRINT((1, "Storing solution in entry %d\n", pos));
+
+    Entry& entry = entries_[pos];
+    entry.parameters = parameters;
+    entry.x = x;
+    entry.z_L = z_L;
+    entry.z_U = z_U;
+    entry.lambda = lambda;
+    entry.mu = mu;
+    entry.last_used = ++counter_;
+  }
+
+  bool WarmStartCache::FindNearest(const std::vector<Number>& parameters,
+                                   Index n,
+                                   Index m,
+                                   std::vector<Number>& x,
+                                   std::vector<Number>& z_L,
+                                   std::vector<Number>& z_U,
+                                   std::vector<Number>& lambda,
+                                   Number& mu,
+                                   Number& distance)
+  {
+    DBG_START_METH("WarmStartCache::FindNearest", dbg_verbosity);
+
+    const Index np = (Index)parameters.size();
+    Index best = -1;
+    Number best_dist2 = 0.;
+    for (Index i=0; i<(Index)entries_.size(); i++) {
+      const Entry& entry = entries_[i];
+      if ((Index)entry.parameters.size() != np ||
+          (Index)entry.x.size() != n || (Index)entry.lambda.size() != m) {
+        continue;
+      }
+      Number dist2 = 0.;
+      for (Index j=0; j<np; j++) {
+        const Number diff = entry.parameters[j] - parameters[j];
+        dist2 += diff*diff;
+      }
+      if (best < 0 || dist2 < best_dist2) {
+        best = i;
+        best_dist2 = dist2;
+      }
+    }
+    if (best < 0) {
+      return false;
+    }
+    DBG_PRINT((1, "Nearest entry is %d\n", best));
+
+    Entry& entry = entries_[best];
+    x = entry.x;
+    z_L = entry.z_L;
+    z_U = entry.z_U;
+    lambda = entry.lambda;
+    mu = entry.mu;
+    distance = sqrt(best_dist2);
+    entry.last_used = ++counter_;
+    return true;
+  }
+
+} // namespace Ipopt
@@ -0,0 +1,130 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+
+#ifndef __IPWARMSTARTCACHE_HPP__
+#define __IPWARMSTARTCACHE_HPP__
+
+#include "IpReferenced.hpp"
+
+#include <vector>
+
+namespace Ipopt
+{
+  /** Cache of primal-dual solutions of a parametric problem.  Each
+   *  entry is keyed by the vector of parameters for which the
+   *  problem has been solved, and it stores the solution (x, z_L,
+   *  z_U, lambda, in the ordering of the TNLP) together with the
+   *  final value of the barrier parameter.
+   *
+   *  The number of entries is bounded; if the cache is full, the
+   *  least recently used entry is replaced.  Since the cache is
+   *  meant to hold a moderate number of entries, the nearest entry
+   *  is found by a linear scan with the Euclidean distance of the
+   *  parameter vectors.
+   */
+  class WarmStartCache : public ReferencedObject
+  {
+  public:
+    /**@name Constructors/Destructors */
+    //@{
+    /** Constructor, given the maximal number of entries. */
+    WarmStartCache(Index max_entries);
+
+    /** Default destructor */
+    virtual ~WarmStartCache();
+    //@}
+
+    /** Store the solution for the given parameters.  If an entry with
+     *  the same parameters exists already, it is overwritten. */
+    void Store(const std::vector<Number>& parameters,
+               const std::vector<Number>& x,
+               const std::vector<Number>& z_L,
+               const std::vector<Number>& z_U,
+               const std::vector<Number>& lambda,
+               Number mu);
+
+    /** Find the entry whose parameters are closest to the given
+     *  parameters among the entries with the same number of
+     *  parameters, variables (n) and constraints (m).  Returns false
+     *  if there is no such entry.  Otherwise the solution is copied
+     *  into the output arguments, and distance is set to the
+     *  Euclidean distance of the parameter vectors. */
+    bool FindNearest(const std::vector<Number>& parameters,
+                     Index n,
+                     Index m,
+                     std::vector<Number>& x,
+                     std::vector<Number>& z_L,
+                     std::vector<Number>& z_U,
+                     std::vector<Number>& lambda,
+                     Number& mu,
+                     Number& distance);
+
+    /** Number of entries currently stored */
+    Index NumEntries() const
+    {
+      return (Index)entries_.size();
+    }
+
+    /** Maximal number of entries */
+    Index MaxEntries() const
+    {
+      return max_entries_;
+    }
+
+    /** Remove all entries */
+    void Clear()
+    {
+      entries_.clear();
+    }
+
+  private:
+    /**@name Default Compiler Generated Methods
+     * (Hidden to avoid implicit creation/calling).
+     * These methods are not implemented and
+     * we do not want the compiler to implement
+     * them for us, so we declare them private
+     * and do not define them. This ensures that
+     * they will not be implicitly created/called. */
+    //@{
+    /** Default Constructor */
+    WarmStartCache();
+
+    /** Copy Constructor */
+    WarmStartCache(const WarmStartCache&);
+
+    /** Overloaded Equals Operator */
+    void operator=(const WarmStartCache&);
+    //@}
+
+    /** One stored solution */
+    struct Entry
+    {
+      std::vector<Number> parameters;
+      std::vector<Number> x;
+      std::vector<Number> z_L;
+      std::vector<Number> z_U;
+      std::vector<Number> lambda;
+      /** Barrier parameter for a warm start from this solution */
+      Number mu;
+      /** Value of counter_ when the entry was last used */
+      unsigned long last_used;
+    };
+
+    /** Maximal number of entries */
+    Index max_entries_;
+
+    /** Stored solutions */
+    std::vector<Entry> entries_;
+
+    /** Counter increased with every access, used to determine the
+     *  least recently used entry */
+    unsigned long counter_;
+  };
+
+} // namespace Ipopt
+
+#endif
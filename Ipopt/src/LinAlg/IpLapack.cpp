@@ -44,7 +44,18 @@ extern "C"
                                ipfint *nrhs, const double *A, ipfint *ldA,
                                ipfintarray *IPIV, double *B, ipfint *ldB,
                                ipfint *info, int trans_len);
-  
+
+  /** LAPACK Fortran subroutine DSYTRF. */
+  void F77_FUNC(dsytrf,DSYTRF)(char *uplo, ipfint *n,
+                               double *A, ipfint *ldA, ipfintarray *IPIV,
+                               double *WORK, ipfint *LWORK, ipfint *info,
+                               int uplo_len);
+  /** LAPACK Fortran subroutine DSYTRS. */
+  void F77_FUNC(dsytrs,DSYTRS)(char *uplo, ipfint *n,
+                               ipfint *nrhs, const double *A, ipfint *ldA,
+                               const ipfintarray *IPIV, double *B,
+                               ipfint *ldB, ipfint *info, int uplo_len);
+
   /** LAPACK Fortran subroutine DPPSV. */
   void F77_FUNC(dppsv,DPPSV)(char *uplo, ipfint *n,
                              ipfint *nrhs, const double *A,
@@ -168,6 +179,76 @@ namespace Ipopt
 
   }
 
+  /* Interface to FORTRAN routine DSYTRF. */
+  void IpLapackDsytrf(Index ndim, Number *a, Index lda, Index* ipiv,
+                      Index& negevals, Index& info)
+  {
+#ifdef COIN_HAS_LAPACK
+    ipfint N=ndim, LDA=lda, INFO;
+    char UPLO = 'L';
+
+    // First we find out how large LWORK should be
+    ipfint LWORK = -1;
+    double WORK_PROBE;
+    F77_FUNC(dsytrf,DSYTRF)(&UPLO, &N, a, &LDA, ipiv, &WORK_PROBE, &LWORK,
+                            &INFO, 1);
+    DBG_ASSERT(INFO==0);
+
+    LWORK = (ipfint) WORK_PROBE;
+    if (LWORK < 1) {
+      LWORK = 1;
+    }
+    double* WORK = new double[LWORK];
+    F77_FUNC(dsytrf,DSYTRF)(&UPLO, &N, a, &LDA, ipiv, WORK, &LWORK,
+                            &INFO, 1);
+    delete [] WORK;
+
+    info = INFO;
+    negevals = 0;
+    if (info == 0) {
+      // Determine the inertia from the block diagonal factor D: A
+      // 1x1 block contributes one eigenvalue with its sign, and a
+      // 2x2 block always has one positive and one negative
+      // eigenvalue.
+      for (Index i=0; i<ndim; i++) {
+        if (ipiv[i] > 0) {
+          if (a[i+i*lda] < 0.) {
+            negevals++;
+          }
+        }
+        else {
+          negevals++;
+          i++;
+        }
+      }
+    }
+#else
+
+    std::string msg = "Ipopt has been compiled without LAPACK routine DSYTRF, but options are chosen that require this dependency.  Abort.";
+    THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+  }
+
+  /* Interface to FORTRAN routine DSYTRS. */
+  void IpLapackDsytrs(Index ndim, Index nrhs, const Number *a, Index lda,
+                      const Index* ipiv, Number *b, Index ldb)
+  {
+#ifdef COIN_HAS_LAPACK
+    ipfint N=ndim, NRHS=nrhs, LDA=lda, LDB=ldb, INFO;
+    char UPLO = 'L';
+
+    F77_FUNC(dsytrs,DSYTRS)(&UPLO, &N, &NRHS, a, &LDA, ipiv, b, &LDB,
+                            &INFO, 1);
+    DBG_ASSERT(INFO==0);
+#else
+
+    std::string msg = "Ipopt has been compiled without LAPACK routine DSYTRS, but options are chosen that require this dependency.  Abort.";
+    THROW_EXCEPTION(LAPACK_NOT_INCLUDED, msg);
+#endif
+
+  }
+
   /* Interface to FORTRAN routine DPPSV. */
   void IpLapackDppsv(Index ndim, Index nrhs, const Number *a,
                      Number *b, Index ldb, Index& info)
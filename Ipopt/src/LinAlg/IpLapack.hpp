@@ -44,6 +44,20 @@ namespace Ipopt
   void IpLapackDgetrs(Index ndim, Index nrhs, const Number *a, Index lda,
                       Index* ipiv, Number *b, Index ldb);
 
+  /** Wrapper for LAPACK subroutine DSYTRF.  Compute the Bunch-Kaufman
+   *  factorization of a symmetric indefinite matrix, given in the
+   *  lower triangle of a.  info is the return value from the LAPACK
+   *  routine.  If the factorization was successful (info is 0),
+   *  negevals is the number of negative eigenvalues of the matrix,
+   *  obtained from the block diagonal factor. */
+  void IpLapackDsytrf(Index ndim, Number *a, Index lda, Index* ipiv,
+                      Index& negevals, Index& info);
+
+  /** Wrapper for LAPACK subroutine DSYTRS.  Solving a linear system
+   *  given a factorization computed by DSYTRF. */
+  void IpLapackDsytrs(Index ndim, Index nrhs, const Number *a, Index lda,
+                      const Index* ipiv, Number *b, Index ldb);
+
   /** Wrapper for LAPACK subroutine DPPSV.  Solves a symmetric positive
    *  definite linear system in packed storage format (upper triangular).
    *  info is the return value from the LAPACK routine. */
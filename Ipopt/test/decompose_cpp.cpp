@@ -0,0 +1,300 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+// Test of the option decompose_independent_blocks: a separable
+// problem, consisting of three copies of HS071 with different
+// constraint bounds and three single free variables, is solved as a
+// whole and decomposed into independent blocks, and the solutions
+// are compared.
+
+#include "IpIpoptApplication.hpp"
+#include "IpTNLPDecomposition.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace Ipopt;
+
+/** Separable test problem.  Block b (b=0,1,2) is HS071 in the
+ *  variables x[4b],...,x[4b+3], with the bounds of the constraints
+ *  shifted by b, and the variables x[12], x[13], x[14] only appear
+ *  in the objective term (x[12+i]-i-1)^2. */
+class SeparableNLP : public TNLP
+{
+public:
+  SeparableNLP()
+  {}
+
+  virtual ~SeparableNLP()
+  {}
+
+  virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
+                            Index& nnz_h_lag, IndexStyleEnum& index_style)
+  {
+    n = 4*n_blocks + n_single;
+    m = 2*n_blocks;
+    nnz_jac_g = 8*n_blocks;
+    nnz_h_lag = 10*n_blocks + n_single;
+    index_style = C_STYLE;
+    return true;
+  }
+
+  virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u,
+                               Index m, Number* g_l, Number* g_u)
+  {
+    for (Index i=0; i<4*n_blocks; i++) {
+      x_l[i] = 1.0;
+      x_u[i] = 5.0;
+    }
+    for (Index i=4*n_blocks; i<n; i++) {
+      x_l[i] = -2e19;
+      x_u[i] = 2e19;
+    }
+    for (Index b=0; b<n_blocks; b++) {
+      g_l[2*b] = 25. - b;
+      g_u[2*b] = 2e19;
+      g_l[2*b+1] = 40. - b;
+      g_u[2*b+1] = 40. - b;
+    }
+    return true;
+  }
+
+  virtual bool get_starting_point(Index n, bool init_x, Number* x,
+                                  bool init_z, Number* z_L, Number* z_U,
+                                  Index m, bool init_lambda,
+                                  Number* lambda)
+  {
+    assert(init_x && !init_z && !init_lambda);
+    for (Index b=0; b<n_blocks; b++) {
+      x[4*b] = 1.0;
+      x[4*b+1] = 5.0;
+      x[4*b+2] = 5.0;
+      x[4*b+3] = 1.0;
+    }
+    for (Index i=4*n_blocks; i<n; i++) {
+      x[i] = 0.;
+    }
+    return true;
+  }
+
+  virtual bool eval_f(Index n, const Number* x, bool new_x,
+                      Number& obj_value)
+  {
+    obj_value = 0.;
+    for (Index b=0; b<n_blocks; b++) {
+      const Number* xb = x + 4*b;
+      obj_value += xb[0] * xb[3] * (xb[0] + xb[1] + xb[2]) + xb[2];
+    }
+    for (Index i=0; i<n_single; i++) {
+      Number d = x[4*n_blocks+i] - (i+1);
+      obj_value += d*d;
+    }
+    return true;
+  }
+
+  virtual bool eval_grad_f(Index n, const Number* x, bool new_x,
+                           Number* grad_f)
+  {
+    for (Index b=0; b<n_blocks; b++) {
+      const Number* xb = x + 4*b;
+      Number* gb = grad_f + 4*b;
+      gb[0] = xb[0] * xb[3] + xb[3] * (xb[0] + xb[1] + xb[2]);
+      gb[1] = xb[0] * xb[3];
+      gb[2] = xb[0] * xb[3] + 1;
+      gb[3] = xb[0] * (xb[0] + xb[1] + xb[2]);
+    }
+    for (Index i=0; i<n_single; i++) {
+      grad_f[4*n_blocks+i] = 2.*(x[4*n_blocks+i] - (i+1));
+    }
+    return true;
+  }
+
+  virtual bool eval_g(Index n, const Number* x, bool new_x,
+                      Index m, Number* g)
+  {
+    for (Index b=0; b<n_blocks; b++) {
+      const Number* xb = x + 4*b;
+      g[2*b] = xb[0] * xb[1] * xb[2] * xb[3];
+      g[2*b+1] = xb[0]*xb[0] + xb[1]*xb[1] + xb[2]*xb[2] + xb[3]*xb[3];
+    }
+    return true;
+  }
+
+  virtual bool eval_jac_g(Index n, const Number* x, bool new_x,
+                          Index m, Index nele_jac, Index* iRow,
+                          Index *jCol, Number* values)
+  {
+    for (Index b=0; b<n_blocks; b++) {
+      if (values == NULL) {
+        for (Index k=0; k<8; k++) {
+          iRow[8*b+k] = 2*b + k/4;
+          jCol[8*b+k] = 4*b + k%4;
+        }
+      }
+      else {
+        const Number* xb = x + 4*b;
+        Number* vb = values + 8*b;
+        vb[0] = xb[1]*xb[2]*xb[3];
+        vb[1] = xb[0]*xb[2]*xb[3];
+        vb[2] = xb[0]*xb[1]*xb[3];
+        vb[3] = xb[0]*xb[1]*xb[2];
+        vb[4] = 2*xb[0];
+        vb[5] = 2*xb[1];
+        vb[6] = 2*xb[2];
+        vb[7] = 2*xb[3];
+      }
+    }
+    return true;
+  }
+
+  virtual bool eval_h(Index n, const Number* x, bool new_x,
+                      Number obj_factor, Index m, const Number* lambda,
+                      bool new_lambda, Index nele_hess, Index* iRow,
+                      Index* jCol, Number* values)
+  {
+    if (values == NULL) {
+      Index idx = 0;
+      for (Index b=0; b<n_blocks; b++) {
+        for (Index row=0; row<4; row++) {
+          for (Index col=0; col<=row; col++) {
+            iRow[idx] = 4*b + row;
+            jCol[idx] = 4*b + col;
+            idx++;
+          }
+        }
+      }
+      for (Index i=4*n_blocks; i<n; i++) {
+        iRow[idx] = i;
+        jCol[idx] = i;
+        idx++;
+      }
+      assert(idx == nele_hess);
+      return true;
+    }
+
+    for (Index b=0; b<n_blocks; b++) {
+      const Number* xb = x + 4*b;
+      const Number* lb = lambda + 2*b;
+      Number* vb = values + 10*b;
+      vb[0] = obj_factor * (2*xb[3]) + lb[1] * 2;
+      vb[1] = obj_factor * (xb[3]) + lb[0] * (xb[2] * xb[3]);
+      vb[2] = lb[1] * 2;
+      vb[3] = obj_factor * (xb[3]) + lb[0] * (xb[1] * xb[3]);
+      vb[4] = lb[0] * (xb[0] * xb[3]);
+      vb[5] = lb[1] * 2;
+      vb[6] = obj_factor * (2*xb[0] + xb[1] + xb[2]) + lb[0] * (xb[1] * xb[2]);
+      vb[7] = obj_factor * (xb[0]) + lb[0] * (xb[0] * xb[2]);
+      vb[8] = obj_factor * (xb[0]) + lb[0] * (xb[0] * xb[1]);
+      vb[9] = lb[1] * 2;
+    }
+    for (Index i=0; i<n_single; i++) {
+      values[10*n_blocks+i] = obj_factor * 2.;
+    }
+    return true;
+  }
+
+  virtual void finalize_solution(SolverReturn status,
+                                 Index n, const Number* x,
+                                 const Number* z_L, const Number* z_U,
+                                 Index m, const Number* g,
+                                 const Number* lambda,
+                                 Number obj_value,
+                                 const IpoptData* ip_data,
+                                 IpoptCalculatedQuantities* ip_cq)
+  {
+    x_sol.assign(x, x+n);
+  }
+
+  /** Solution passed to finalize_solution */
+  std::vector<Number> x_sol;
+
+private:
+  static const Index n_blocks = 3;
+  static const Index n_single = 3;
+
+  SeparableNLP(const SeparableNLP&);
+  SeparableNLP& operator=(const SeparableNLP&);
+};
+
+/** Solve a new instance of the test problem, with or without
+ *  decomposition.  Returns false if the solve failed. */
+static bool solve(bool decompose, SmartPtr<SeparableNLP>& nlp)
+{
+  SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+  app->Options()->SetNumericValue("tol", 1e-9);
+  app->Options()->SetIntegerValue("print_level", 0);
+  app->Options()->SetStringValue("decompose_independent_blocks",
+                                 decompose ? "yes" : "no");
+  app->Options()->SetIntegerValue("decompose_min_block_size", 5);
+  if (app->Initialize() != Solve_Succeeded) {
+    printf("Initialization failed\n");
+    return false;
+  }
+
+  nlp = new SeparableNLP();
+  ApplicationReturnStatus status = app->OptimizeTNLP(GetRawPtr(nlp));
+  if (status != Solve_Succeeded) {
+    printf("%s solve failed with status %d\n",
+           decompose ? "Decomposed" : "Monolithic", status);
+    return false;
+  }
+  return true;
+}
+
+int main(int argv, char* argc[])
+{
+  int failed = 0;
+
+  // Each HS071 copy has 4 variables and 2 constraints, so that with a
+  // minimal block size of 5 the single variables are merged into one
+  // block
+  SmartPtr<SeparableNLP> nlp = new SeparableNLP();
+  SmartPtr<TNLPDecomposition> decomp = new TNLPDecomposition(*nlp);
+  Index ncomp = decomp->Analyze(1);
+  printf("Number of blocks without merging: %d\n", ncomp);
+  if (ncomp != 6) {
+    failed++;
+  }
+  ncomp = decomp->Analyze(5);
+  printf("Number of blocks with minimal block size 5: %d\n", ncomp);
+  if (ncomp != 4) {
+    failed++;
+  }
+
+  SmartPtr<SeparableNLP> mono_nlp;
+  SmartPtr<SeparableNLP> decomp_nlp;
+  if (!solve(false, mono_nlp) || !solve(true, decomp_nlp)) {
+    return 1;
+  }
+
+  // The objective values are computed at the final points, since the
+  // value passed to finalize_solution in the monolithic solve is
+  // computed before the final iterate is moved into the bounds
+  Index n = (Index)mono_nlp->x_sol.size();
+  Number diff = 0.;
+  for (Index i=0; i<n; i++) {
+    diff = Max(diff, std::abs(mono_nlp->x_sol[i] - decomp_nlp->x_sol[i]));
+  }
+  Number mono_obj, decomp_obj;
+  mono_nlp->eval_f(n, &mono_nlp->x_sol[0], true, mono_obj);
+  decomp_nlp->eval_f(n, &decomp_nlp->x_sol[0], true, decomp_obj);
+  printf("Objective: monolithic %.10e, decomposed %.10e\n",
+         mono_obj, decomp_obj);
+  printf("max |x_monolithic - x_decomposed| = %e\n", diff);
+  if (diff > 1e-6 ||
+      std::abs(mono_obj - decomp_obj) > 1e-6*(1. + std::abs(mono_obj))) {
+    failed++;
+  }
+
+  if (failed) {
+    printf("\nDecomposition test FAILED.\n");
+    return 1;
+  }
+  printf("\nDecomposed solution agrees with monolithic solution.\n");
+  return 0;
+}
@@ -0,0 +1,287 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+// Test of the option hessian_vector_products: HS071 is solved once
+// with the Hessian values from eval_h, and once with only products of
+// the Hessian with vectors from eval_h_prod, and the solutions are
+// compared.
+
+#include "IpIpoptApplication.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+using namespace Ipopt;
+
+/** HS071, with both eval_h and eval_h_prod implemented. */
+class HessProdNLP : public TNLP
+{
+public:
+  HessProdNLP(bool products_only)
+      :
+      products_only_(products_only),
+      n_h_prod_(0)
+  {}
+
+  virtual ~HessProdNLP()
+  {}
+
+  virtual bool get_nlp_info(Index& n, Index& m, Index& nnz_jac_g,
+                            Index& nnz_h_lag, IndexStyleEnum& index_style)
+  {
+    n = 4;
+    m = 2;
+    nnz_jac_g = 8;
+    // The Hessian structure is never requested if only products are used
+    nnz_h_lag = products_only_ ? 0 : 10;
+    index_style = C_STYLE;
+    return true;
+  }
+
+  virtual bool get_bounds_info(Index n, Number* x_l, Number* x_u,
+                               Index m, Number* g_l, Number* g_u)
+  {
+    for (Index i=0; i<4; i++) {
+      x_l[i] = 1.0;
+      x_u[i] = 5.0;
+    }
+    g_l[0] = 25;
+    g_u[0] = 2e19;
+    g_l[1] = g_u[1] = 40.0;
+    return true;
+  }
+
+  virtual bool get_starting_point(Index n, bool init_x, Number* x,
+                                  bool init_z, Number* z_L, Number* z_U,
+                                  Index m, bool init_lambda,
+                                  Number* lambda)
+  {
+    assert(init_x && !init_z && !init_lambda);
+    x[0] = 1.0;
+    x[1] = 5.0;
+    x[2] = 5.0;
+    x[3] = 1.0;
+    return true;
+  }
+
+  virtual bool eval_f(Index n, const Number* x, bool new_x,
+                      Number& obj_value)
+  {
+    obj_value = x[0] * x[3] * (x[0] + x[1] + x[2]) + x[2];
+    return true;
+  }
+
+  virtual bool eval_grad_f(Index n, const Number* x, bool new_x,
+                           Number* grad_f)
+  {
+    grad_f[0] = x[0] * x[3] + x[3] * (x[0] + x[1] + x[2]);
+    grad_f[1] = x[0] * x[3];
+    grad_f[2] = x[0] * x[3] + 1;
+    grad_f[3] = x[0] * (x[0] + x[1] + x[2]);
+    return true;
+  }
+
+  virtual bool eval_g(Index n, const Number* x, bool new_x,
+                      Index m, Number* g)
+  {
+    g[0] = x[0] * x[1] * x[2] * x[3];
+    g[1] = x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3];
+    return true;
+  }
+
+  virtual bool eval_jac_g(Index n, const Number* x, bool new_x,
+                          Index m, Index nele_jac, Index* iRow,
+                          Index *jCol, Number* values)
+  {
+    if (values == NULL) {
+      for (Index k=0; k<8; k++) {
+        iRow[k] = k/4;
+        jCol[k] = k%4;
+      }
+    }
+    else {
+      values[0] = x[1]*x[2]*x[3];
+      values[1] = x[0]*x[2]*x[3];
+      values[2] = x[0]*x[1]*x[3];
+      values[3] = x[0]*x[1]*x[2];
+      values[4] = 2*x[0];
+      values[5] = 2*x[1];
+      values[6] = 2*x[2];
+      values[7] = 2*x[3];
+    }
+    return true;
+  }
+
+  virtual bool eval_h(Index n, const Number* x, bool new_x,
+                      Number obj_factor, Index m, const Number* lambda,
+                      bool new_lambda, Index nele_hess, Index* iRow,
+                      Index* jCol, Number* values)
+  {
+    if (products_only_) {
+      // must not be called with hessian_vector_products=yes
+      return false;
+    }
+    if (values == NULL) {
+      Index idx = 0;
+      for (Index row=0; row<4; row++) {
+        for (Index col=0; col<=row; col++) {
+          iRow[idx] = row;
+          jCol[idx] = col;
+          idx++;
+        }
+      }
+      assert(idx == nele_hess);
+      return true;
+    }
+
+    Number H[4][4];
+    dense_hessian(x, obj_factor, lambda, H);
+    Index idx = 0;
+    for (Index row=0; row<4; row++) {
+      for (Index col=0; col<=row; col++) {
+        values[idx++] = H[row][col];
+      }
+    }
+    return true;
+  }
+
+  virtual bool eval_h_prod(Index n, const Number* x, bool new_x,
+                           Number obj_factor, Index m,
+                           const Number* lambda, bool new_lambda,
+                           const Number* v, Number* hv)
+  {
+    Number H[4][4];
+    dense_hessian(x, obj_factor, lambda, H);
+    for (Index i=0; i<4; i++) {
+      hv[i] = 0.;
+      for (Index j=0; j<4; j++) {
+        hv[i] += H[i][j]*v[j];
+      }
+    }
+    n_h_prod_++;
+    return true;
+  }
+
+  virtual void finalize_solution(SolverReturn status,
+                                 Index n, const Number* x,
+                                 const Number* z_L, const Number* z_U,
+                                 Index m, const Number* g,
+                                 const Number* lambda,
+                                 Number obj_value,
+                                 const IpoptData* ip_data,
+                                 IpoptCalculatedQuantities* ip_cq)
+  {
+    x_sol.assign(x, x+n);
+  }
+
+  /** Number of calls of eval_h_prod */
+  Index NumHessProducts() const
+  {
+    return n_h_prod_;
+  }
+
+  /** Solution passed to finalize_solution */
+  std::vector<Number> x_sol;
+
+private:
+  /** Full (symmetric) Hessian of the Lagrangian */
+  static void dense_hessian(const Number* x, Number obj_factor,
+                            const Number* lambda, Number H[4][4])
+  {
+    H[0][0] = obj_factor * (2*x[3]) + lambda[1] * 2;
+    H[1][0] = obj_factor * (x[3]) + lambda[0] * (x[2] * x[3]);
+    H[1][1] = lambda[1] * 2;
+    H[2][0] = obj_factor * (x[3]) + lambda[0] * (x[1] * x[3]);
+    H[2][1] = lambda[0] * (x[0] * x[3]);
+    H[2][2] = lambda[1] * 2;
+    H[3][0] = obj_factor * (2*x[0] + x[1] + x[2]) + lambda[0] * (x[1] * x[2]);
+    H[3][1] = obj_factor * (x[0]) + lambda[0] * (x[0] * x[2]);
+    H[3][2] = obj_factor * (x[0]) + lambda[0] * (x[0] * x[1]);
+    H[3][3] = lambda[1] * 2;
+    for (Index i=0; i<4; i++) {
+      for (Index j=i+1; j<4; j++) {
+        H[i][j] = H[j][i];
+      }
+    }
+  }
+
+  bool products_only_;
+  Index n_h_prod_;
+
+  HessProdNLP(const HessProdNLP&);
+  HessProdNLP& operator=(const HessProdNLP&);
+};
+
+/** Solve a new instance of the test problem, either with eval_h and
+ *  the dense augmented system solver, or with eval_h_prod and the
+ *  Krylov solver.  Returns false if the solve failed. */
+static bool solve(bool products_only, SmartPtr<HessProdNLP>& nlp)
+{
+  SmartPtr<IpoptApplication> app = IpoptApplicationFactory();
+  app->Options()->SetNumericValue("tol", 1e-9);
+  app->Options()->SetIntegerValue("print_level", 0);
+  if (products_only) {
+    app->Options()->SetStringValue("hessian_vector_products", "yes");
+    app->Options()->SetStringValue("aug_system_solver", "krylov");
+  }
+  else {
+    app->Options()->SetStringValue("aug_system_solver", "dense");
+  }
+  // No options file, so that the choice of the solvers is not changed
+  if (app->Initialize("") != Solve_Succeeded) {
+    printf("Initialization failed\n");
+    return false;
+  }
+
+  nlp = new HessProdNLP(products_only);
+  ApplicationReturnStatus status = app->OptimizeTNLP(GetRawPtr(nlp));
+  if (status != Solve_Succeeded) {
+    printf("Solve with %s failed with status %d\n",
+           products_only ? "eval_h_prod" : "eval_h", status);
+    return false;
+  }
+  return true;
+}
+
+int main(int argv, char* argc[])
+{
+  SmartPtr<HessProdNLP> h_nlp;
+  SmartPtr<HessProdNLP> hprod_nlp;
+  if (!solve(false, h_nlp) || !solve(true, hprod_nlp)) {
+    return 1;
+  }
+
+  int failed = 0;
+  printf("Number of Hessian-vector products: %d\n",
+         hprod_nlp->NumHessProducts());
+  if (hprod_nlp->NumHessProducts() == 0) {
+    failed++;
+  }
+
+  Index n = (Index)h_nlp->x_sol.size();
+  Number diff = 0.;
+  for (Index i=0; i<n; i++) {
+    diff = Max(diff, std::abs(h_nlp->x_sol[i] - hprod_nlp->x_sol[i]));
+  }
+  Number h_obj, hprod_obj;
+  h_nlp->eval_f(n, &h_nlp->x_sol[0], true, h_obj);
+  hprod_nlp->eval_f(n, &hprod_nlp->x_sol[0], true, hprod_obj);
+  printf("Objective: eval_h %.10e, eval_h_prod %.10e\n", h_obj, hprod_obj);
+  printf("max |x_eval_h - x_eval_h_prod| = %e\n", diff);
+  if (diff > 1e-6 ||
+      std::abs(h_obj - hprod_obj) > 1e-6*(1. + std::abs(h_obj))) {
+    failed++;
+  }
+
+  if (failed) {
+    printf("\nHessian-vector product test FAILED.\n");
+    return 1;
+  }
+  printf("\nSolution with eval_h_prod agrees with solution with eval_h.\n");
+  return 0;
+}
@@ -0,0 +1,364 @@
+/* Copyright (C) 2026 International Business Machines and others.
+ * All Rights Reserved.
+ * This code is published under the Eclipse Public License.
+ *
+ * $Id$
+ *
+ * Test of IpoptReSolve: the HS071 problem with a fixed variable is
+ * solved with IpoptSolve, and then re-solved with IpoptReSolve after
+ * changing the bounds, first without changing the structure of the
+ * problem, and then by releasing the fixed variable and removing
+ * bounds, so that the previous structure cannot be reused.  The
+ * results are compared with those of a fresh IpoptSolve for the same
+ * bounds.
+ */
+
+#include "IpStdCInterface.h"
+#include <stdlib.h>
+#include <assert.h>
+#include <stdio.h>
+#include <math.h>
+
+/* Function Declarations */
+Bool eval_f(Index n, Number* x, Bool new_x,
+            Number* obj_value, UserDataPtr user_data);
+
+Bool eval_grad_f(Index n, Number* x, Bool new_x,
+                 Number* grad_f, UserDataPtr user_data);
+
+Bool eval_g(Index n, Number* x, Bool new_x,
+            Index m, Number* g, UserDataPtr user_data);
+
+Bool eval_jac_g(Index n, Number *x, Bool new_x,
+                Index m, Index nele_jac,
+                Index *iRow, Index *jCol, Number *values,
+                UserDataPtr user_data);
+
+Bool eval_h(Index n, Number *x, Bool new_x, Number obj_factor,
+            Index m, Number *lambda, Bool new_lambda,
+            Index nele_hess, Index *iRow, Index *jCol,
+            Number *values, UserDataPtr user_data);
+
+/* This is an example how user_data can be used. */
+struct MyUserData
+{
+  Number g_offset[2]; /* This is an offset for the constraints.  */
+};
+
+/* Create the HS071 problem with the given variable bounds */
+static IpoptProblem create_problem(Number* x_L, Number* x_U)
+{
+  Number g_L[2];
+  Number g_U[2];
+  IpoptProblem nlp;
+
+  g_L[0] = 25;
+  g_U[0] = 2e19;
+  g_L[1] = 40;
+  g_U[1] = 40;
+
+  nlp = CreateIpoptProblem(4, x_L, x_U, 2, g_L, g_U, 8, 10, 0,
+                           &eval_f, &eval_g, &eval_grad_f,
+                           &eval_jac_g, &eval_h);
+  AddIpoptNumOption(nlp, "tol", 1e-9);
+  AddIpoptIntOption(nlp, "print_level", 0);
+  return nlp;
+}
+
+/* Set the HS071 starting point */
+static void set_starting_point(Number* x)
+{
+  x[0] = 1.0;
+  x[1] = 5.0;
+  x[2] = 5.0;
+  x[3] = 1.0;
+}
+
+/* Solve a new problem with the given bounds from scratch and compare
+   its solution with x and obj.  Returns 0 if they agree. */
+static int compare_with_fresh_solve(const char* name, Number* x_L,
+                                    Number* x_U, Number* x, Number obj,
+                                    struct MyUserData* user_data)
+{
+  IpoptProblem nlp = create_problem(x_L, x_U);
+  Number x_ref[4];
+  Number obj_ref;
+  Number diff = 0.;
+  Index i;
+  enum ApplicationReturnStatus status;
+
+  set_starting_point(x_ref);
+  status = IpoptSolve(nlp, x_ref, NULL, &obj_ref, NULL, NULL, NULL,
+                      user_data);
+  FreeIpoptProblem(nlp);
+  if (status != Solve_Succeeded) {
+    printf("%s: reference solve failed with status %d\n", name, status);
+    return 1;
+  }
+
+  for (i=0; i<4; i++) {
+    if (fabs(x[i] - x_ref[i]) > diff) {
+      diff = fabs(x[i] - x_ref[i]);
+    }
+  }
+  printf("%s: f(x*) = %.10e (reference %.10e), max |x - x_ref| = %e\n",
+         name, obj, obj_ref, diff);
+  if (diff > 1e-6 || fabs(obj - obj_ref) > 1e-6*(1. + fabs(obj_ref))) {
+    printf("%s: solution differs from reference solution\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+/* Change the bounds of nlp, re-solve it with IpoptReSolve, and
+   compare the solution with that of a fresh solve.  Returns 0 if
+   they agree. */
+static int resolve_and_compare(IpoptProblem nlp, const char* name,
+                               Number* x_L, Number* x_U,
+                               struct MyUserData* user_data)
+{
+  Number x[4];
+  Number obj;
+  Index i;
+  enum ApplicationReturnStatus status;
+
+  SetIpoptProblemBounds(nlp, x_L, x_U, NULL, NULL);
+
+  /* Move the starting point into the new bounds */
+  set_starting_point(x);
+  for (i=0; i<4; i++) {
+    if (x[i] < x_L[i]) {
+      x[i] = x_L[i];
+    }
+    if (x[i] > x_U[i]) {
+      x[i] = x_U[i];
+    }
+  }
+
+  status = IpoptReSolve(nlp, x, NULL, &obj, NULL, NULL, NULL, user_data);
+  if (status != Solve_Succeeded) {
+    printf("%s: failed with status %d\n", name, status);
+    return 1;
+  }
+  return compare_with_fresh_solve(name, x_L, x_U, x, obj, user_data);
+}
+
+/* Main Program */
+int main()
+{
+  Number x_L[4];
+  Number x_U[4];
+  Number x[4];
+  Number obj;
+  IpoptProblem nlp;
+  enum ApplicationReturnStatus status;
+  struct MyUserData user_data;
+  int failed = 0;
+  Index i;
+
+  user_data.g_offset[0] = 0.;
+  user_data.g_offset[1] = 0.;
+
+  /* Start with the last variable fixed */
+  for (i=0; i<4; i++) {
+    x_L[i] = 1.0;
+    x_U[i] = 5.0;
+  }
+  x_L[3] = 2.0;
+  x_U[3] = 2.0;
+  nlp = create_problem(x_L, x_U);
+
+  set_starting_point(x);
+  x[3] = 2.0;
+  status = IpoptSolve(nlp, x, NULL, &obj, NULL, NULL, NULL, &user_data);
+  if (status != Solve_Succeeded) {
+    printf("Initial solve failed with status %d\n", status);
+    FreeIpoptProblem(nlp);
+    return 1;
+  }
+  failed += compare_with_fresh_solve("Initial solve", x_L, x_U, x, obj,
+                                     &user_data);
+
+  /* Tighten the upper bounds and change the value of the fixed
+     variable; the structure of the problem is the same, so that the
+     previous solve is reused */
+  for (i=0; i<3; i++) {
+    x_U[i] = 4.5;
+  }
+  x_L[3] = 1.5;
+  x_U[3] = 1.5;
+  failed += resolve_and_compare(nlp, "Re-solve with changed bounds",
+                                x_L, x_U, &user_data);
+
+  /* Release the fixed variable; this changes the structure of the
+     problem, so that it has to be solved from scratch */
+  x_L[3] = 1.0;
+  x_U[3] = 4.5;
+  failed += resolve_and_compare(nlp, "Re-solve with released variable",
+                                x_L, x_U, &user_data);
+
+  /* Remove the upper bounds of the last two variables, which changes
+     the structure again */
+  x_U[2] = 2e19;
+  x_U[3] = 2e19;
+  failed += resolve_and_compare(nlp, "Re-solve with removed bounds",
+                                x_L, x_U, &user_data);
+
+  FreeIpoptProblem(nlp);
+
+  if (failed) {
+    printf("\n%d re-solve test(s) FAILED.\n", failed);
+    return 1;
+  }
+  printf("\nAll re-solves agree with fresh solves.\n");
+  return 0;
+}
+
+
+/* Function Implementations */
+Bool eval_f(Index n, Number* x, Bool new_x,
+            Number* obj_value, UserDataPtr user_data)
+{
+  assert(n == 4);
+
+  *obj_value = x[0] * x[3] * (x[0] + x[1] + x[2]) + x[2];
+
+  return TRUE;
+}
+
+Bool eval_grad_f(Index n, Number* x, Bool new_x,
+                 Number* grad_f, UserDataPtr user_data)
+{
+  assert(n == 4);
+
+  grad_f[0] = x[0] * x[3] + x[3] * (x[0] + x[1] + x[2]);
+  grad_f[1] = x[0] * x[3];
+  grad_f[2] = x[0] * x[3] + 1;
+  grad_f[3] = x[0] * (x[0] + x[1] + x[2]);
+
+  return TRUE;
+}
+
+Bool eval_g(Index n, Number* x, Bool new_x,
+            Index m, Number* g, UserDataPtr user_data)
+{
+  struct MyUserData* my_data = user_data;
+
+  assert(n == 4);
+  assert(m == 2);
+
+  g[0] = x[0] * x[1] * x[2] * x[3] + my_data->g_offset[0];
+  g[1] = x[0]*x[0] + x[1]*x[1] + x[2]*x[2] + x[3]*x[3] + my_data->g_offset[1];
+
+  return TRUE;
+}
+
+Bool eval_jac_g(Index n, Number *x, Bool new_x,
+                Index m, Index nele_jac,
+                Index *iRow, Index *jCol, Number *values,
+                UserDataPtr user_data)
+{
+  if (values == NULL) {
+    /* return the structure of the jacobian */
+
+    /* this particular jacobian is dense */
+    iRow[0] = 0;
+    jCol[0] = 0;
+    iRow[1] = 0;
+    jCol[1] = 1;
+    iRow[2] = 0;
+    jCol[2] = 2;
+    iRow[3] = 0;
+    jCol[3] = 3;
+    iRow[4] = 1;
+    jCol[4] = 0;
+    iRow[5] = 1;
+    jCol[5] = 1;
+    iRow[6] = 1;
+    jCol[6] = 2;
+    iRow[7] = 1;
+    jCol[7] = 3;
+  }
+  else {
+    /* return the values of the jacobian of the constraints */
+
+    values[0] = x[1]*x[2]*x[3]; /* 0,0 */
+    values[1] = x[0]*x[2]*x[3]; /* 0,1 */
+    values[2] = x[0]*x[1]*x[3]; /* 0,2 */
+    values[3] = x[0]*x[1]*x[2]; /* 0,3 */
+
+    values[4] = 2*x[0];         /* 1,0 */
+    values[5] = 2*x[1];         /* 1,1 */
+    values[6] = 2*x[2];         /* 1,2 */
+    values[7] = 2*x[3];         /* 1,3 */
+  }
+
+  return TRUE;
+}
+
+Bool eval_h(Index n, Number *x, Bool new_x, Number obj_factor,
+            Index m, Number *lambda, Bool new_lambda,
+            Index nele_hess, Index *iRow, Index *jCol,
+            Number *values, UserDataPtr user_data)
+{
+  Index idx = 0; /* nonzero element counter */
+  Index row = 0; /* row counter for loop */
+  Index col = 0; /* col counter for loop */
+  if (values == NULL) {
+    /* return the structure. This is a symmetric matrix, fill the lower left
+     * triangle only. */
+
+    /* the hessian for this problem is actually dense */
+    idx=0;
+    for (row = 0; row < 4; row++) {
+      for (col = 0; col <= row; col++) {
+        iRow[idx] = row;
+        jCol[idx] = col;
+        idx++;
+      }
+    }
+
+    assert(idx == nele_hess);
+  }
+  else {
+    /* return the values. This is a symmetric matrix, fill the lower left
+     * triangle only */
+
+    /* fill the objective portion */
+    values[0] = obj_factor * (2*x[3]);               /* 0,0 */
+
+    values[1] = obj_factor * (x[3]);                 /* 1,0 */
+    values[2] = 0;                                   /* 1,1 */
+
+    values[3] = obj_factor * (x[3]);                 /* 2,0 */
+    values[4] = 0;                                   /* 2,1 */
+    values[5] = 0;                                   /* 2,2 */
+
+    values[6] = obj_factor * (2*x[0] + x[1] + x[2]); /* 3,0 */
+    values[7] = obj_factor * (x[0]);                 /* 3,1 */
+    values[8] = obj_factor * (x[0]);                 /* 3,2 */
+    values[9] = 0;                                   /* 3,3 */
+
+
+    /* add the portion for the first constraint */
+    values[1] += lambda[0] * (x[2] * x[3]);          /* 1,0 */
+
+    values[3] += lambda[0] * (x[1] * x[3]);          /* 2,0 */
+    values[4] += lambda[0] * (x[0] * x[3]);          /* 2,1 */
+
+    values[6] += lambda[0] * (x[1] * x[2]);          /* 3,0 */
+    values[7] += lambda[0] * (x[0] * x[2]);          /* 3,1 */
+    values[8] += lambda[0] * (x[0] * x[1]);          /* 3,2 */
+
+    /* add the portion for the second constraint */
+    values[0] += lambda[1] * 2;                      /* 0,0 */
+
+    values[2] += lambda[1] * 2;                      /* 1,1 */
+
+    values[5] += lambda[1] * 2;                      /* 2,2 */
+
+    values[9] += lambda[1] * 2;                      /* 3,3 */
+  }
+
+  return TRUE;
+}
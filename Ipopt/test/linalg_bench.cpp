@@ -0,0 +1,498 @@
+// Copyright (C) 2026 International Business Machines and others.
+// All Rights Reserved.
+// This code is published under the Eclipse Public License.
+//
+// $Id$
+//
+// Microbenchmarks for the kernels of the linear algebra layer, i.e.,
+// the vector operations and matrix-vector products used for the
+// residuals and the iterative refinement, and the conversion of the
+// KKT matrix into the format of the linear solvers.
+
+#include "IpUtils.hpp"
+#include "IpDenseVector.hpp"
+#include "IpCompoundVector.hpp"
+#include "IpGenTMatrix.hpp"
+#include "IpSymTMatrix.hpp"
+#include "IpCompoundMatrix.hpp"
+#include "IpCompoundSymMatrix.hpp"
+#include "IpTripletHelper.hpp"
+#include "IpTripletToCSRConverter.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+using namespace Ipopt;
+
+/** Base class for a kernel that is timed */
+class BenchKernel
+{
+public:
+  virtual ~BenchKernel()
+  {}
+  /** Execute the kernel once */
+  virtual void Run() = 0;
+};
+
+/** Minimal time (in seconds) for the repeated execution of a kernel */
+static Number min_time = 0.2;
+
+/** Bandwidth of the STREAM triad in GB/s, used as reference */
+static Number stream_bw = 0.;
+
+/** Determine the time for one execution of the kernel.  The kernel is
+ *  executed with an increasing number of repetitions, until the total
+ *  time exceeds min_time. */
+static Number TimeKernel(BenchKernel& kernel)
+{
+  kernel.Run();
+  Index reps = 1;
+  while (true) {
+    Number start = WallclockTime();
+    for (Index i=0; i<reps; i++) {
+      kernel.Run();
+    }
+    Number time = WallclockTime() - start;
+    if (time >= min_time || reps >= (1<<30)) {
+      return time/reps;
+    }
+    reps = (time > 0.01*min_time) ?
+           (Index)(1.2*reps*min_time/time) + 1 : 100*reps;
+  }
+}
+
+/** Print the result line for a kernel that processes n_elems
+ *  elements (vector entries or matrix elements) per call, with a
+ *  given number of bytes transferred from/to memory and floating
+ *  point operations per element. */
+static void Report(const char* name, Index n, Index n_elems,
+                   Number bytes_per_elem, Number flops_per_elem,
+                   Number time)
+{
+  Number ns_per_elem = 1e9*time/n_elems;
+  Number gbs = bytes_per_elem*n_elems/time*1e-9;
+  Number gflops = flops_per_elem*n_elems/time*1e-9;
+  if (bytes_per_elem > 0.) {
+    printf("%-30s %9d %10d %9.3f %9.2f %9.3f %7.1f%%\n", name, n, n_elems,
+           ns_per_elem, gbs, gflops, 100.*gbs/stream_bw);
+  }
+  else {
+    // no meaningful estimate of the memory traffic
+    printf("%-30s %9d %10d %9.3f %9s %9s %8s\n", name, n, n_elems,
+           ns_per_elem, "-", "-", "-");
+  }
+}
+
+/** Fill an array with random numbers */
+static void FillRandom(Index n, Number* values)
+{
+  for (Index i=0; i<n; i++) {
+    values[i] = IpRandom01() - 0.5;
+  }
+}
+
+/** Random index between 1 and n */
+static Index RandomIndex(Index n)
+{
+  Index i = (Index)(IpRandom01()*n) + 1;
+  return i > n ? n : i;
+}
+
+/** The triad of the STREAM benchmark on plain arrays */
+class StreamTriad : public BenchKernel
+{
+public:
+  StreamTriad(Index n)
+      :
+      n_(n), a_(n), b_(n), c_(n)
+  {
+    FillRandom(n, &b_[0]);
+    FillRandom(n, &c_[0]);
+  }
+  void Run()
+  {
+    Number* a = &a_[0];
+    const Number* b = &b_[0];
+    const Number* c = &c_[0];
+    for (Index i=0; i<n_; i++) {
+      a[i] = b[i] + 3.*c[i];
+    }
+  }
+private:
+  Index n_;
+  std::vector<Number> a_, b_, c_;
+};
+
+/** Operations on DenseVectors */
+class DenseVectorKernel : public BenchKernel
+{
+public:
+  enum Op { COPY, SCAL, AXPY, ADDTWO, DOT, NRM2, ASUM, ELEMMULT };
+
+  DenseVectorKernel(Index n, Op op)
+      :
+      op_(op),
+      result_(0.)
+  {
+    SmartPtr<DenseVectorSpace> space = new DenseVectorSpace(n);
+    x_ = space->MakeNewDenseVector();
+    y_ = space->MakeNewDenseVector();
+    z_ = space->MakeNewDenseVector();
+    FillRandom(n, x_->Values());
+    FillRandom(n, y_->Values());
+    FillRandom(n, z_->Values());
+    if (op == ELEMMULT) {
+      // entries of absolute value one, so that the repeated
+      // multiplication does not lead to underflow
+      Number* x = x_->Values();
+      for (Index i=0; i<n; i++) {
+        x[i] = x[i] < 0. ? -1. : 1.;
+      }
+    }
+  }
+  void Run()
+  {
+    switch (op_) {
+    case COPY:
+      y_->Copy(*x_);
+      break;
+    case SCAL:
+      y_->Scal(-1.);
+      break;
+    case AXPY:
+      y_->Axpy(1e-6, *x_);
+      break;
+    case ADDTWO:
+      z_->AddTwoVectors(1e-6, *x_, 1e-6, *y_, 0.99);
+      break;
+    case DOT:
+      // Values() marks the vector as changed, so that the cached
+      // result is not used
+      x_->Values();
+      result_ += x_->Dot(*y_);
+      break;
+    case NRM2:
+      x_->Values();
+      result_ += x_->Nrm2();
+      break;
+    case ASUM:
+      x_->Values();
+      result_ += x_->Asum();
+      break;
+    case ELEMMULT:
+      y_->ElementWiseMultiply(*x_);
+      break;
+    }
+  }
+private:
+  Op op_;
+  SmartPtr<DenseVector> x_, y_, z_;
+  Number result_;
+};
+
+/** Products of a matrix (or its transpose) with a vector */
+class MatVecKernel : public BenchKernel
+{
+public:
+  /** Constructor, given the matrix and the vector spaces of x and y
+   *  in y = A*x or y = A^T*x */
+  MatVecKernel(const Matrix& A, bool trans,
+               const VectorSpace& x_space, const VectorSpace& y_space)
+      :
+      A_(&A), trans_(trans)
+  {
+    x_ = x_space.MakeNew();
+    y_ = y_space.MakeNew();
+    std::vector<Number> values(x_->Dim() > 0 ? x_->Dim() : 1);
+    FillRandom(x_->Dim(), &values[0]);
+    TripletHelper::PutValuesInVector(x_->Dim(), &values[0], *x_);
+    y_->Set(0.);
+  }
+  void Run()
+  {
+    if (trans_) {
+      A_->TransMultVector(1., *x_, 0.5, *y_);
+    }
+    else {
+      A_->MultVector(1., *x_, 0.5, *y_);
+    }
+  }
+private:
+  SmartPtr<const Matrix> A_;
+  bool trans_;
+  SmartPtr<Vector> x_, y_;
+};
+
+/** Extraction of the values of a matrix in triplet format */
+class FillValuesKernel : public BenchKernel
+{
+public:
+  FillValuesKernel(const Matrix& A)
+      :
+      A_(&A), n_entries_(TripletHelper::GetNumberEntries(A)),
+      values_(n_entries_ > 0 ? n_entries_ : 1)
+  {}
+  void Run()
+  {
+    TripletHelper::FillValues(n_entries_, *A_, &values_[0]);
+  }
+  Index NumberEntries() const
+  {
+    return n_entries_;
+  }
+private:
+  SmartPtr<const Matrix> A_;
+  Index n_entries_;
+  std::vector<Number> values_;
+};
+
+/** Conversion of the values of a symmetric matrix from triplet format
+ *  to compressed row format */
+class ConvertValuesKernel : public BenchKernel
+{
+public:
+  ConvertValuesKernel(TripletToCSRConverter& converter,
+                      Index nonzeros_triplet, Index nonzeros_compressed)
+      :
+      converter_(&converter),
+      a_triplet_(nonzeros_triplet),
+      a_compressed_(nonzeros_compressed)
+  {
+    FillRandom(nonzeros_triplet, &a_triplet_[0]);
+  }
+  void Run()
+  {
+    converter_->ConvertValues((Index)a_triplet_.size(), &a_triplet_[0],
+                              (Index)a_compressed_.size(), &a_compressed_[0]);
+  }
+private:
+  SmartPtr<TripletToCSRConverter> converter_;
+  std::vector<Number> a_triplet_;
+  std::vector<Number> a_compressed_;
+};
+
+/** Create a random n x m GenTMatrix with nnz_row elements per row */
+static SmartPtr<GenTMatrix> RandomGenTMatrix(Index n, Index m, Index nnz_row)
+{
+  Index nnz = n*nnz_row;
+  std::vector<Index> irow(nnz), jcol(nnz);
+  for (Index i=0; i<n; i++) {
+    for (Index k=0; k<nnz_row; k++) {
+      irow[i*nnz_row+k] = i+1;
+      jcol[i*nnz_row+k] = RandomIndex(m);
+    }
+  }
+  SmartPtr<GenTMatrixSpace> space =
+    new GenTMatrixSpace(n, m, nnz, &irow[0], &jcol[0]);
+  SmartPtr<GenTMatrix> A = space->MakeNewGenTMatrix();
+  std::vector<Number> values(nnz);
+  FillRandom(nnz, &values[0]);
+  A->SetValues(&values[0]);
+  return A;
+}
+
+/** Create a random symmetric n x n SymTMatrix with the diagonal and
+ *  nnz_row-1 elements per row in the lower triangle */
+static SmartPtr<SymTMatrix> RandomSymTMatrix(Index n, Index nnz_row)
+{
+  std::vector<Index> irow, jcol;
+  for (Index i=1; i<=n; i++) {
+    irow.push_back(i);
+    jcol.push_back(i);
+    for (Index k=1; k<nnz_row && i>1; k++) {
+      irow.push_back(i);
+      jcol.push_back(RandomIndex(i-1));
+    }
+  }
+  Index nnz = (Index)irow.size();
+  SmartPtr<SymTMatrixSpace> space =
+    new SymTMatrixSpace(n, nnz, &irow[0], &jcol[0]);
+  SmartPtr<SymTMatrix> A = space->MakeNewSymTMatrix();
+  std::vector<Number> values(nnz);
+  FillRandom(nnz, &values[0]);
+  A->SetValues(&values[0]);
+  return A;
+}
+
+/** Run all kernels for vectors of size n and matrices with nnz_row
+ *  elements per row */
+static void RunBenchmarks(Index n, Index nnz_row)
+{
+  printf("\n%-30s %9s %10s %9s %9s %9s %8s\n", "kernel", "n", "elements",
+         "ns/elem", "GB/s", "GFLOP/s", "STREAM");
+
+  // Vector operations (bytes and flops per vector element)
+  {
+    struct {
+      const char* name;
+      DenseVectorKernel::Op op;
+      Number bytes;
+      Number flops;
+    }
+    ops[] = {
+      {"DenseVector::Copy", DenseVectorKernel::COPY, 16., 0.},
+      {"DenseVector::Scal", DenseVectorKernel::SCAL, 16., 1.},
+      {"DenseVector::Axpy", DenseVectorKernel::AXPY, 24., 2.},
+      {"DenseVector::AddTwoVectors", DenseVectorKernel::ADDTWO, 32., 5.},
+      {"DenseVector::Dot", DenseVectorKernel::DOT, 16., 2.},
+      {"DenseVector::Nrm2", DenseVectorKernel::NRM2, 8., 2.},
+      {"DenseVector::Asum", DenseVectorKernel::ASUM, 8., 1.},
+      {"DenseVector::ElementWiseMult", DenseVectorKernel::ELEMMULT, 24., 1.}
+    };
+    for (Index i=0; i<(Index)(sizeof(ops)/sizeof(ops[0])); i++) {
+      DenseVectorKernel kernel(n, ops[i].op);
+      Report(ops[i].name, n, n, ops[i].bytes, ops[i].flops,
+             TimeKernel(kernel));
+    }
+  }
+
+  // Sparse matrix-vector products (bytes and flops per matrix
+  // element: value and two indices, access to x and update of y)
+  Index n_c = n/2 > 0 ? n/2 : 1;
+  SmartPtr<DenseVectorSpace> x_space = new DenseVectorSpace(n);
+  SmartPtr<DenseVectorSpace> c_space = new DenseVectorSpace(n_c);
+  SmartPtr<GenTMatrix> J = RandomGenTMatrix(n_c, n, nnz_row);
+  {
+    MatVecKernel kernel(*J, false, *x_space, *c_space);
+    Report("GenTMatrix::MultVector", n, J->Nonzeros(), 40., 2.,
+           TimeKernel(kernel));
+  }
+  {
+    MatVecKernel kernel(*J, true, *c_space, *x_space);
+    Report("GenTMatrix::TransMultVector", n, J->Nonzeros(), 40., 2.,
+           TimeKernel(kernel));
+  }
+  SmartPtr<SymTMatrix> W = RandomSymTMatrix(n, nnz_row);
+  {
+    MatVecKernel kernel(*W, false, *x_space, *x_space);
+    Report("SymTMatrix::MultVector", n, W->Nonzeros(), 64., 4.,
+           TimeKernel(kernel));
+  }
+
+  // Compound matrix with nblocks x nblocks GenTMatrix blocks; this
+  // measures the overhead of the traversal of the blocks
+  {
+    Index nblocks = 4;
+    Index nb = n/nblocks > 0 ? n/nblocks : 1;
+    SmartPtr<CompoundMatrixSpace> space =
+      new CompoundMatrixSpace(nblocks, nblocks, nb*nblocks, nb*nblocks);
+    SmartPtr<DenseVectorSpace> block_space = new DenseVectorSpace(nb);
+    SmartPtr<CompoundVectorSpace> vec_space =
+      new CompoundVectorSpace(nblocks, nb*nblocks);
+    std::vector<SmartPtr<GenTMatrix> > blocks;
+    for (Index i=0; i<nblocks; i++) {
+      space->SetBlockRows(i, nb);
+      space->SetBlockCols(i, nb);
+      vec_space->SetCompSpace(i, *block_space);
+    }
+    for (Index i=0; i<nblocks; i++) {
+      for (Index j=0; j<nblocks; j++) {
+        blocks.push_back(RandomGenTMatrix(nb, nb, (nnz_row+nblocks-1)/nblocks));
+        space->SetCompSpace(i, j, *blocks.back()->OwnerSpace());
+      }
+    }
+    SmartPtr<CompoundMatrix> C = space->MakeNewCompoundMatrix();
+    Index nnz = 0;
+    for (Index i=0; i<nblocks; i++) {
+      for (Index j=0; j<nblocks; j++) {
+        C->SetComp(i, j, *blocks[i*nblocks+j]);
+        nnz += blocks[i*nblocks+j]->Nonzeros();
+      }
+    }
+    MatVecKernel kernel(*C, false, *vec_space, *vec_space);
+    Report("CompoundMatrix::MultVector", n, nnz, 40., 2.,
+           TimeKernel(kernel));
+  }
+
+  // KKT-like matrix [W J^T; J 0] as CompoundSymMatrix, as it is
+  // passed to the linear solvers
+  SmartPtr<CompoundSymMatrixSpace> kkt_space =
+    new CompoundSymMatrixSpace(2, n + n_c);
+  kkt_space->SetBlockDim(0, n);
+  kkt_space->SetBlockDim(1, n_c);
+  kkt_space->SetCompSpace(0, 0, *W->OwnerSpace());
+  kkt_space->SetCompSpace(1, 0, *J->OwnerSpace());
+  SmartPtr<CompoundSymMatrix> kkt = kkt_space->MakeNewCompoundSymMatrix();
+  kkt->SetComp(0, 0, *W);
+  kkt->SetComp(1, 0, *J);
+  {
+    FillValuesKernel kernel(*kkt);
+    Report("TripletHelper::FillValues", n, kernel.NumberEntries(), 16., 0.,
+           TimeKernel(kernel));
+  }
+
+  // Conversion to compressed row format
+  {
+    Index nnz = TripletHelper::GetNumberEntries(*kkt);
+    std::vector<Index> irow(nnz), jcol(nnz);
+    TripletHelper::FillRowCol(nnz, *kkt, &irow[0], &jcol[0]);
+    SmartPtr<TripletToCSRConverter> converter = new TripletToCSRConverter(0);
+    Number start = WallclockTime();
+    Index nnz_compressed =
+      converter->InitializeConverter(n + n_c, nnz, &irow[0], &jcol[0]);
+    Number init_time = WallclockTime() - start;
+    Report("TripletToCSR::Initialize", n, nnz, 0., 0., init_time);
+    ConvertValuesKernel kernel(*converter, nnz, nnz_compressed);
+    Report("TripletToCSR::ConvertValues", n, nnz, 20., 0.,
+           TimeKernel(kernel));
+  }
+}
+
+static void PrintUsage(const char* exe)
+{
+  printf("Usage: %s [-nnz K] [-time T] [N ...]\n\n", exe);
+  printf("Runs the benchmarks for vectors of size N (default: 1000 100000 1000000).\n");
+  printf("  -nnz K    number of elements per row of the sparse matrices (default: 5)\n");
+  printf("  -time T   minimal time in seconds for the measurement of a kernel (default: 0.2)\n");
+}
+
+int main(int argc, char* argv[])
+{
+  std::vector<Index> sizes;
+  Index nnz_row = 5;
+  for (int i=1; i<argc; i++) {
+    if (!strcmp(argv[i], "-nnz") && i+1<argc) {
+      nnz_row = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-time") && i+1<argc) {
+      min_time = atof(argv[++i]);
+    }
+    else if (atoi(argv[i]) > 0) {
+      sizes.push_back(atoi(argv[i]));
+    }
+    else {
+      PrintUsage(argv[0]);
+      return -1;
+    }
+  }
+  if (nnz_row <= 0 || min_time <= 0.) {
+    PrintUsage(argv[0]);
+    return -1;
+  }
+  if (sizes.empty()) {
+    sizes.push_back(1000);
+    sizes.push_back(100000);
+    sizes.push_back(1000000);
+  }
+
+  // Reference bandwidth with arrays that do not fit into the caches
+  {
+    Index n = 1<<23;
+    StreamTriad triad(n);
+    Number time = TimeKernel(triad);
+    stream_bw = 24.*n/time*1e-9;
+    printf("STREAM triad bandwidth: %.2f GB/s (%.2f GFLOP/s)\n",
+           stream_bw, 2.*n/time*1e-9);
+    printf("The bandwidth of the kernels is estimated from the number of bytes\n"
+           "accessed per element; for small sizes the data is in the caches and\n"
+           "the bandwidth can exceed the STREAM bandwidth.\n");
+  }
+
+  for (Index i=0; i<(Index)sizes.size(); i++) {
+    RunBenchmarks(sizes[i], nnz_row);
+  }
+
+  return 0;
+}